@@ -0,0 +1,149 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "arena.h"
+#include "outils.h"
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ALIGNEMENT alignof(max_align_t)
+#define TAILLE_MORCEAU ((size_t) 64*1024)
+
+/*
+ * Un morceau de mémoire de l'arène. Les blocs sont découpés dans 'donnees',
+ * de 'debut' vers 'fin'.
+ */
+typedef struct Morceau {
+	struct Morceau * suivant;
+	size_t taille;
+	alignas(max_align_t) unsigned char donnees[];
+} Morceau;
+
+struct Arena {
+	// Doit rester en premier : allocateur_avl_arena() renvoie son adresse.
+	struct libavl_allocator avl;
+	Morceau * morceaux;
+	unsigned char * libre;   // Début de la place libre du morceau courant
+	unsigned char * fin;     // Fin du morceau courant
+	unsigned char * dernier; // Dernier bloc distribué
+	size_t taille;
+};
+
+size_t arrondir( size_t n ){
+	return ( n + ALIGNEMENT - 1 ) & ~( ALIGNEMENT - 1 );
+}
+
+void* allouer_avl_arena( struct libavl_allocator* allocateur, size_t n ){
+	return allouer_arena( (Arena*) allocateur, n );
+}
+
+void rendre_avl_arena( struct libavl_allocator* allocateur, void* ptr ){
+}
+
+Arena* creer_arena(){
+	Arena* arena = xmalloc( sizeof(Arena) );
+	arena->avl.libavl_malloc = allouer_avl_arena;
+	arena->avl.libavl_free = rendre_avl_arena;
+	arena->morceaux = NULL;
+	arena->libre = NULL;
+	arena->fin = NULL;
+	arena->dernier = NULL;
+	arena->taille = 0;
+	return arena;
+}
+
+void liberer_arena( Arena* arena ){
+	if( ! arena ) return;
+	Morceau * m = arena->morceaux;
+	while( m ){
+		Morceau * suivant = m->suivant;
+		xfree( m );
+		m = suivant;
+	}
+	xfree( arena );
+}
+
+/*
+ * Ajoute un morceau d'au moins 'n' octets à l'arène. Un bloc plus gros que
+ * le quart d'un morceau reçoit son propre morceau, pour ne pas gaspiller la 
+ * fin du morceau courant.
+ */
+void* allouer_morceau( Arena* arena, size_t n ){
+	size_t taille = ( n > TAILLE_MORCEAU / 4 ) ? n : TAILLE_MORCEAU;
+	Morceau * m = xmalloc( sizeof(Morceau) + taille );
+	m->taille = taille;
+	arena->taille += taille;
+	if( taille == n && arena->morceaux ){
+		// Morceau dédié : on le range après le morceau courant.
+		m->suivant = arena->morceaux->suivant;
+		arena->morceaux->suivant = m;
+		return m->donnees;
+	}
+	m->suivant = arena->morceaux;
+	arena->morceaux = m;
+	arena->libre = m->donnees + n;
+	arena->fin = m->donnees + taille;
+	arena->dernier = m->donnees;
+	return m->donnees;
+}
+
+void* allouer_arena( Arena* arena, size_t n ){
+	if( ! arena ) return xmalloc( n );
+	n = arrondir( n ? n : 1 );
+	if( (size_t) ( arena->fin - arena->libre ) < n ){
+		return allouer_morceau( arena, n );
+	}
+	arena->dernier = arena->libre;
+	arena->libre += n;
+	return arena->dernier;
+}
+
+void* reallouer_arena( 
+	Arena* arena, void* ptr, size_t ancienne_taille, size_t n 
+){
+	if( ! arena ) return xrealloc( ptr, n );
+	if( ! ptr ) return allouer_arena( arena, n );
+	if( 
+		ptr == arena->dernier 
+		&& (size_t) ( arena->fin - arena->dernier ) >= arrondir( n )
+	){
+		arena->libre = arena->dernier + arrondir( n );
+		return ptr;
+	}
+	if( n <= ancienne_taille ) return ptr;
+	void* res = allouer_arena( arena, n );
+	memcpy( res, ptr, ancienne_taille );
+	return res;
+}
+
+void rendre_arena( Arena* arena, void* ptr ){
+	if( ! arena ) xfree( ptr );
+}
+
+size_t taille_arena( const Arena* arena ){
+	return arena->taille;
+}
+
+struct libavl_allocator* allocateur_avl_arena( Arena* arena ){
+	if( ! arena ) return NULL;
+	return &( arena->avl );
+}
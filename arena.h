@@ -0,0 +1,92 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file arena.h */ 
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stddef.h>
+#include "avl.h"
+
+/**
+ * @brief Définit le type d'une arène.
+ *
+ * Une arène distribue des blocs de mémoire découpés dans de gros morceaux
+ * alloués par xmalloc(). Les blocs ne sont jamais rendus un par un : toute la
+ * mémoire de l'arène est rendue d'un coup par liberer_arena(), en un temps 
+ * proportionnel au nombre de morceaux et non au nombre de blocs.
+ *
+ * Un automate, ses tables et ses ensembles sont rangés dans une arène : 
+ * détruire un automate ne demande donc pas de parcourir ses structures.
+ *
+ * Toutes les fonctions ci-dessous acceptent une arène NULL : elles se 
+ * comportent alors comme xmalloc(), xrealloc() et xfree().
+ */
+typedef struct Arena Arena;
+
+/**
+ * @brief Crée une arène vide.
+ */
+Arena* creer_arena();
+
+/**
+ * @brief Rend toute la mémoire de l'arène, y compris l'arène elle-même.
+ */
+void liberer_arena( Arena* arena );
+
+/**
+ * @brief Renvoie un bloc de 'n' octets, aligné pour tous les types.
+ */
+void* allouer_arena( Arena* arena, size_t n );
+
+/**
+ * @brief Agrandit ou rétrécit un bloc de 'ancienne_taille' octets renvoyé
+ * par allouer_arena().
+ *
+ * Le contenu du bloc est conservé. Si le bloc est le dernier bloc distribué 
+ * par l'arène, il est agrandi sur place quand c'est possible ; sinon, le bloc
+ * est recopié et l'ancien bloc n'est récupéré qu'à la destruction de l'arène.
+ */
+void* reallouer_arena( 
+	Arena* arena, void* ptr, size_t ancienne_taille, size_t n 
+);
+
+/**
+ * @brief Rend un bloc à l'arène.
+ *
+ * Si l'arène n'est pas NULL, cette fonction ne fait rien : le bloc sera 
+ * récupéré par liberer_arena().
+ */
+void rendre_arena( Arena* arena, void* ptr );
+
+/**
+ * @brief Renvoie le nombre d'octets demandés au système par l'arène.
+ */
+size_t taille_arena( const Arena* arena );
+
+/**
+ * @brief Renvoie un allocateur de la bibliothèque libavl qui puise dans 
+ * l'arène. Les noeuds d'un AVL créé avec cet allocateur disparaissent avec
+ * l'arène. Pour une arène NULL, renvoie NULL (l'allocateur par défaut).
+ */
+struct libavl_allocator* allocateur_avl_arena( Arena* arena );
+
+#endif
@@ -19,6 +19,8 @@
  */
 
 #include "automate.h"
+#include "automate_fige.h"
+#include "lignes.h"
 #include "table.h"
 #include "ensemble.h"
 #include "outils.h"
@@ -34,30 +36,16 @@
 
 #include <math.h>
 
-void action_get_max_etat( const intptr_t element, void* data ){
-    int * max = (int*) data;
-    if( *max < element ) *max = element;
-}
-
+// Les états sont rangés dans l'ordre : le plus petit et le plus grand sont
+// aux extrémités de l'ensemble.
 int get_max_etat( const Automate* automate ){
-    int max = INT_MIN;
-
-    pour_tout_element( automate->etats, action_get_max_etat, &max );
-
-    return max;
-}
-
-void action_get_min_etat( const intptr_t element, void* data ){
-    int * min = (int*) data;
-    if( *min > element ) *min = element;
+    Ensemble_iterateur it = dernier_iterateur_ensemble( automate->etats );
+    return iterateur_ensemble_est_vide( it ) ? INT_MIN : get_element( it );
 }
 
 int get_min_etat( const Automate* automate ){
-    int min = INT_MAX;
-
-    pour_tout_element( automate->etats, action_get_min_etat, &min );
-
-    return min;
+    Ensemble_iterateur it = premier_iterateur_ensemble( automate->etats );
+    return iterateur_ensemble_est_vide( it ) ? INT_MAX : get_element( it );
 }
 
 
@@ -73,6 +61,15 @@ int comparer_cle(const Cle *a, const Cle *b) {
     return 0;
 }
 
+uint64_t hacher_cle( const Cle* cle ){
+    return hacher_entier( 
+        (intptr_t) ( 
+            ( (uint64_t) (uint32_t) cle->origine << 8 ) 
+            ^ (unsigned char) cle->lettre 
+        )
+    );
+}
+
 void print_cle( const Cle * a){
     printf( "(%d, %c)" , a->origine, (char) (a->lettre) );
 }
@@ -83,7 +80,7 @@ void supprimer_cle( Cle* cle ){
 
 void initialiser_cle( Cle* cle, int origine, char lettre ){
     cle->origine = origine;
-    cle->lettre = (int) lettre;
+    cle->lettre = (unsigned char) lettre;
 }
 
 Cle * creer_cle( int origine, char lettre ){
@@ -96,33 +93,38 @@ Cle * copier_cle( const Cle* cle ){
     return creer_cle( cle->origine, cle->lettre );
 }
 
+/*
+ * Toutes les structures d'un automate (ensembles, table des transitions, 
+ * clés) sont prises dans son arène : liberer_automate() n'a rien à parcourir.
+ */
+Ensemble * creer_ensemble_automate( Automate * automate ){
+    return creer_ensemble_arena( 
+            automate->arena, ENSEMBLE_AVL, NULL, NULL, NULL 
+            );
+}
+
 Automate * creer_automate(){
-    Automate * automate = xmalloc( sizeof(Automate) );
-    automate->etats = creer_ensemble( NULL, NULL, NULL );
-    automate->alphabet = creer_ensemble( NULL, NULL, NULL );
-    automate->transitions = creer_table(
+    Arena * arena = creer_arena();
+    Automate * automate = allouer_arena( arena, sizeof(Automate) );
+    automate->arena = arena;
+    automate->etats = creer_ensemble_automate( automate );
+    automate->alphabet = creer_ensemble_automate( automate );
+    // Les clés sont copiées dans l'arène par ajouter_transition().
+    automate->transitions = creer_table_hachee_arena(
+            arena,
+            ( uint64_t(*)(const intptr_t) ) hacher_cle,
             ( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
-            ( intptr_t (*)( const intptr_t ) ) copier_cle,
-            ( void(*)(intptr_t) ) supprimer_cle
+            NULL, NULL
             );
-    automate->initiaux = creer_ensemble( NULL, NULL, NULL );
-    automate->finaux = creer_ensemble( NULL, NULL, NULL );
-    automate->vide = creer_ensemble( NULL, NULL, NULL ); 
+    automate->initiaux = creer_ensemble_automate( automate );
+    automate->finaux = creer_ensemble_automate( automate );
+    automate->vide = creer_ensemble_automate( automate ); 
     return automate;
 }
 
 void liberer_automate( Automate * automate ){
     assert( automate );
-    liberer_ensemble( automate->vide );
-    liberer_ensemble( automate->finaux );
-    liberer_ensemble( automate->initiaux );
-    pour_toute_valeur_table(
-            automate->transitions, ( void(*)(intptr_t) ) liberer_ensemble
-            );
-    liberer_table( automate->transitions );
-    liberer_ensemble( automate->alphabet );
-    liberer_ensemble( automate->etats );
-    xfree(automate);
+    liberer_arena( automate->arena );
 }
 
 const Ensemble * get_etats( const Automate* automate ){
@@ -146,7 +148,7 @@ void ajouter_etat( Automate * automate, int etat ){
 }
 
 void ajouter_lettre( Automate * automate, char lettre ){
-    ajouter_element( automate->alphabet, lettre );
+    ajouter_element( automate->alphabet, (unsigned char) lettre );
 }
 
 void ajouter_transition(
@@ -161,14 +163,35 @@ void ajouter_transition(
     Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
     Ensemble * ens;
     if( iterateur_est_vide( it ) ){
-        ens = creer_ensemble( NULL, NULL, NULL );
-        add_table( automate->transitions, (intptr_t) &cle, (intptr_t) ens );
+        ens = creer_ensemble_arena(
+                automate->arena, ENSEMBLE_TABLEAU, NULL, NULL, NULL 
+                );
+        Cle * copie = allouer_arena( automate->arena, sizeof(Cle) );
+        *copie = cle;
+        add_table( automate->transitions, (intptr_t) copie, (intptr_t) ens );
     }else{
         ens = (Ensemble*) get_valeur( it );
     }
     ajouter_element( ens, fin );
 }
 
+/*
+ * Comme ajouter_transition(), quand l'origine et la fin sont déjà des états
+ * de l'automate, que la lettre est dans l'alphabet et que l'origine n'a 
+ * encore aucune transition par cette lettre : aucune recherche n'est faite.
+ */
+void ajouter_nouvelle_transition(
+        Automate * automate, int origine, char lettre, int fin
+        ){
+    Cle * cle = allouer_arena( automate->arena, sizeof(Cle) );
+    initialiser_cle( cle, origine, lettre );
+    Ensemble * ens = creer_ensemble_arena(
+            automate->arena, ENSEMBLE_TABLEAU, NULL, NULL, NULL 
+            );
+    add_table( automate->transitions, (intptr_t) cle, (intptr_t) ens );
+    ajouter_element( ens, fin );
+}
+
 void ajouter_etat_final(
         Automate * automate, int etat_final
         ){
@@ -194,11 +217,13 @@ const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
     }
 }
 
-Ensemble * delta(
+/*
+ * Ajoute à 'res' les états atteints depuis 'etats_courants' en lisant 'lettre'.
+ */
+void ajouter_delta(
+        Ensemble * res,
         const Automate* automate, const Ensemble * etats_courants, char lettre
         ){
-    Ensemble * res = creer_ensemble( NULL, NULL, NULL );
-
     Ensemble_iterateur it;
     for( 
             it = premier_iterateur_ensemble( etats_courants );
@@ -210,23 +235,60 @@ Ensemble * delta(
                 );
         ajouter_elements( res, fins );
     }
+}
 
+Ensemble * delta(
+        const Automate* automate, const Ensemble * etats_courants, char lettre
+        ){
+    Ensemble * res = creer_ensemble_semblable( etats_courants );
+    ajouter_delta( res, automate, etats_courants, lettre );
     return res;
 }
 
 Ensemble * delta_star(
         const Automate* automate, const Ensemble * etats_courants, const char* mot
         ){
-    int len = strlen( mot );
-    int i;
-    Ensemble * old = copier_ensemble( etats_courants );
-    Ensemble * new = old;
-    for( i=0; i<len; i++ ){
-        new = delta( automate, old, *(mot+i) );
-        liberer_ensemble( old );
-        old = new;
+    return delta_star_octets( 
+            automate, etats_courants, (const uint8_t*) mot, strlen( mot ) 
+            );
+}
+
+Ensemble * delta_star_octets(
+        const Automate* automate, const Ensemble * etats_courants, 
+        const uint8_t* mot, size_t taille
+        ){
+    size_t i;
+    // On alterne entre deux ensembles alloués une fois pour toutes. Quand 
+    // les états sont positifs et pas trop grands devant leur nombre, ce sont
+    // des tableaux de bits : les vider et les remplir ne demande alors 
+    // aucune allocation. Sinon, un tableau de bits serait à la taille du 
+    // plus grand état et on prend un tableau trié.
+    Ensemble * old;
+    int min = get_min_etat( automate );
+    int max = get_max_etat( automate );
+    Ensemble_iterateur premier = premier_iterateur_ensemble( etats_courants );
+    Ensemble_iterateur dernier = dernier_iterateur_ensemble( etats_courants );
+    if( ! iterateur_ensemble_est_vide( premier ) ){
+        if( get_element( premier ) < min ) min = get_element( premier );
+        if( get_element( dernier ) > max ) max = get_element( dernier );
     }
-    return new;
+    if( 
+        min >= 0 && 
+        max < 4 * (int64_t) taille_ensemble( get_etats( automate ) ) + 64
+    ){
+        old = creer_ensemble_bitset();
+    }else{
+        old = creer_ensemble_tableau( NULL, NULL, NULL );
+    }
+    ajouter_elements( old, etats_courants );
+    Ensemble * new = creer_ensemble_semblable( old );
+    for( i=0; i<taille; i++ ){
+        vider_ensemble( new );
+        ajouter_delta( new, automate, old, (char) mot[i] );
+        swap_ensemble( old, new );
+    }
+    liberer_ensemble( new );
+    return old;
 }
 
 void pour_toute_transition(
@@ -522,38 +584,38 @@ int etat_maximal( const Automate * automate ){
 
 Ensemble* etats_accessibles( const Automate * automate, int etat ){
     Ensemble * resultat = creer_ensemble( NULL, NULL, NULL );
-    Ensemble * courants = creer_ensemble( NULL, NULL, NULL );
+    Fifo * f = creer_fifo();
     ajouter_element( resultat, etat );
-    ajouter_elements( courants, resultat );
-
-    int n = taille_ensemble( get_etats( automate ) );
-    int i;
-
-    Ensemble* tmp;
-    Ensemble* next;
+    ajouter_fifo( f, etat );
 
-    for( i=0; i< n-1; i++ ){
-
-        next = creer_ensemble( NULL, NULL, NULL );
-
-        Ensemble_iterateur it;
+    // Parcours en largeur : chaque état est visité une seule fois.
+    while( ! est_vide( f ) ){
+        int origine = retirer_fifo( f );
+        Ensemble_iterateur it_lettre;
         for( 
-                it = premier_iterateur_ensemble( get_alphabet( automate ) );
-                ! iterateur_ensemble_est_vide( it );
-                it = iterateur_suivant_ensemble( it )
+                it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+                ! iterateur_ensemble_est_vide( it_lettre );
+                it_lettre = iterateur_suivant_ensemble( it_lettre )
            ){
-            tmp = delta( automate, courants, get_element(it) );
-            ajouter_elements( next, tmp );
-            liberer_ensemble( tmp );
+            const Ensemble * fins = voisins(
+                    automate, origine, get_element( it_lettre )
+                    );
+            Ensemble_iterateur it;
+            for( 
+                    it = premier_iterateur_ensemble( fins );
+                    ! iterateur_ensemble_est_vide( it );
+                    it = iterateur_suivant_ensemble( it )
+               ){
+                int fin = get_element( it );
+                if( ! est_dans_l_ensemble( resultat, fin ) ){
+                    ajouter_element( resultat, fin );
+                    ajouter_fifo( f, fin );
+                }
+            }
         }
-
-        ajouter_elements( resultat, next );
-        liberer_ensemble( courants );
-        courants = next;
     }
 
-    liberer_ensemble( courants );
-
+    liberer_fifo( f );
     return resultat;
 }
 
@@ -639,6 +701,124 @@ Automate *automate_accessible( const Automate * automate ){
     return res;
 }
 
+typedef struct {
+    Automate * automate;
+    const Table * nouveaux;
+} data_renumeroter_t;
+
+int nouveau_numero( const Table * nouveaux, int etat ){
+    return get_valeur( trouver_table( nouveaux, etat ) );
+}
+
+void action_renumeroter_transition( 
+        int origine, char lettre, int fin, void* data 
+        ){
+    data_renumeroter_t * d = (data_renumeroter_t*) data;
+    ajouter_transition( 
+            d->automate, nouveau_numero( d->nouveaux, origine ), lettre, 
+            nouveau_numero( d->nouveaux, fin )
+            );
+}
+
+/*
+ * Donne le numéro *nb à 'etat' s'il n'en a pas encore. Renvoie 1 si l'état
+ * vient d'être numéroté.
+ */
+int numeroter_etat( Table * nouveaux, int etat, int * nb ){
+    if( ! iterateur_est_vide( trouver_table( nouveaux, etat ) ) ) return 0;
+    add_table( nouveaux, etat, (*nb)++ );
+    return 1;
+}
+
+Automate * renumeroter_automate( 
+        const Automate * automate, int en_largeur, Table ** correspondance 
+        ){
+    Table * nouveaux = creer_table_hachee( NULL, NULL, NULL, NULL );
+    int nb = 0;
+    Ensemble_iterateur it;
+
+    if( en_largeur ){
+        Fifo * f = creer_fifo();
+        for(
+                it = premier_iterateur_ensemble( get_initiaux( automate ) );
+                ! iterateur_ensemble_est_vide( it );
+                it = iterateur_suivant_ensemble( it )
+           ){
+            if( numeroter_etat( nouveaux, get_element( it ), &nb ) ){
+                ajouter_fifo( f, get_element( it ) );
+            }
+        }
+        while( ! est_vide( f ) ){
+            int origine = retirer_fifo( f );
+            Ensemble_iterateur it_lettre;
+            for( 
+                    it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+                    ! iterateur_ensemble_est_vide( it_lettre );
+                    it_lettre = iterateur_suivant_ensemble( it_lettre )
+               ){
+                const Ensemble * fins = voisins(
+                        automate, origine, get_element( it_lettre )
+                        );
+                for( 
+                        it = premier_iterateur_ensemble( fins );
+                        ! iterateur_ensemble_est_vide( it );
+                        it = iterateur_suivant_ensemble( it )
+                   ){
+                    if( numeroter_etat( nouveaux, get_element( it ), &nb ) ){
+                        ajouter_fifo( f, get_element( it ) );
+                    }
+                }
+            }
+        }
+        liberer_fifo( f );
+    }
+    // Les états restants, dans l'ordre croissant
+    for(
+            it = premier_iterateur_ensemble( get_etats( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        numeroter_etat( nouveaux, get_element( it ), &nb );
+    }
+
+    Automate * res = creer_automate();
+    for(
+            it = premier_iterateur_ensemble( get_etats( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        ajouter_etat( res, nouveau_numero( nouveaux, get_element( it ) ) );
+    }
+    for(
+            it = premier_iterateur_ensemble( get_initiaux( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        ajouter_etat_initial( 
+                res, nouveau_numero( nouveaux, get_element( it ) ) 
+                );
+    }
+    for(
+            it = premier_iterateur_ensemble( get_finaux( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        ajouter_etat_final( 
+                res, nouveau_numero( nouveaux, get_element( it ) ) 
+                );
+    }
+    ajouter_elements( res->alphabet, get_alphabet( automate ) );
+    data_renumeroter_t data = { res, nouveaux };
+    pour_toute_transition( automate, action_renumeroter_transition, &data );
+
+    if( correspondance ){
+        *correspondance = nouveaux;
+    }else{
+        liberer_table( nouveaux );
+    }
+    return res;
+}
+
 /* 
  * ===  FUNCTION  ======================================================================
  *         Name:  miroir
@@ -733,7 +913,9 @@ int est_un_etat_final_de_l_automate( const Automate* automate, int etat ){
 }
 
 int est_une_lettre_de_l_automate( const Automate* automate, char lettre ){
-    return est_dans_l_ensemble( get_alphabet( automate ), lettre );
+    return est_dans_l_ensemble( 
+            get_alphabet( automate ), (unsigned char) lettre 
+            );
 }
 
 void print_ensemble_2( const intptr_t ens ){
@@ -764,7 +946,17 @@ void print_automate( const Automate * automate ){
 }
 
 int le_mot_est_reconnu( const Automate* automate, const char* mot ){
-    Ensemble * arrivee = delta_star( automate, get_initiaux(automate) , mot ); 
+    return le_mot_est_reconnu_octets( 
+            automate, (const uint8_t*) mot, strlen( mot ) 
+            );
+}
+
+int le_mot_est_reconnu_octets( 
+        const Automate* automate, const uint8_t* mot, size_t taille 
+        ){
+    Ensemble * arrivee = delta_star_octets( 
+            automate, get_initiaux(automate), mot, taille 
+            ); 
 
     int result = 0;
 
@@ -783,103 +975,533 @@ int le_mot_est_reconnu( const Automate* automate, const char* mot ){
     return result;
 }
 
-int ajouter_ensemble( 
-        const Ensemble* ens,
-        Table* ensemble_to_id, Table* id_to_ensemble, Fifo* f, 
-        Automate * aut, int next_id
-        ){
+Automate * creer_automate_deterministe( const Automate* automate ){
+    Automate * res = creer_automate();
+    Automate_fige * fige = figer_automate( automate );
+    int largeur = fige->nb_mots > 0 ? fige->nb_mots : 1;
+
+    // Rang de chaque lettre de l'alphabet, dans l'ordre croissant.
+    int nb_lettres = 0;
+    int rang[256];
+    unsigned char lettres[256];
+    memset( rang, -1, sizeof(rang) );
+    Ensemble_iterateur it_lettre;
+    for(
+            it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+            ! iterateur_ensemble_est_vide( it_lettre );
+            it_lettre = iterateur_suivant_ensemble( it_lettre )
+       ){
+        unsigned char lettre = get_element( it_lettre );
+        rang[lettre] = nb_lettres;
+        lettres[ nb_lettres++ ] = lettre;
+        ajouter_lettre( res, lettre );
+    }
 
-    Table_iterateur it = trouver_table( ensemble_to_id, (intptr_t) ens );
-    if( iterateur_est_vide( it ) ){
-        add_table( ensemble_to_id, (intptr_t) ens, next_id );
-        add_table( id_to_ensemble, next_id, (intptr_t) ens );
-        ajouter_fifo( f, (intptr_t) ens );
-        ajouter_etat( aut, next_id );
-        return next_id+1;
-    }else{
-        return next_id;
+    // Les sous-ensembles sont des tableaux de bits, numérotés dans l'ordre 
+    // où on les rencontre : ce numéro est celui de l'état du déterminisé, 
+    // et les ensembles de numéro supérieur au courant forment la file.
+    Lignes ensembles;
+    initialiser_lignes( &ensembles, largeur );
+    uint64_t * courant = xmalloc( 
+        (size_t) ( nb_lettres + 1 ) * largeur * sizeof(uint64_t) 
+    );
+    uint64_t * images = courant + largeur;
+    memset( courant, 0, largeur * sizeof(uint64_t) );
+    memcpy( courant, fige->initiaux, fige->nb_mots * sizeof(uint64_t) );
+    interner_ligne( &ensembles, courant );
+    ajouter_etat( res, 0 );
+    ajouter_etat_initial( res, 0 );
+
+    int id_e;
+    for( id_e = 0; id_e < ensembles.nb; id_e++ ){
+        memcpy( 
+            courant, lire_ligne( &ensembles, id_e ), 
+            largeur * sizeof(uint64_t) 
+        );
+
+        // Les images par toutes les lettres en un seul parcours de 
+        // l'ensemble : les groupes de transitions de chaque état sont 
+        // rangés par lettre.
+        memset( images, 0, (size_t) nb_lettres * largeur * sizeof(uint64_t) );
+        int final = 0;
+        int w;
+        for( w=0; w<fige->nb_mots; w++ ){
+            uint64_t mot = courant[w];
+            final |= ( mot & fige->finaux[w] ) != 0;
+            while( mot ){
+                int etat = w * 64 + __builtin_ctzll( mot );
+                mot &= mot - 1;
+                int g;
+                for( 
+                    g = fige->debut_groupes[etat]; 
+                    g < fige->debut_groupes[etat+1]; 
+                    g++ 
+                ){
+                    uint64_t * image = 
+                        images + (size_t) rang[ fige->lettres[g] ] * largeur;
+                    int t;
+                    for( 
+                        t = fige->debut_cibles[g]; 
+                        t < fige->debut_cibles[g+1]; 
+                        t++ 
+                    ){
+                        int cible = fige->cibles[t];
+                        image[cible/64] |= (uint64_t) 1 << (cible%64);
+                    }
+                }
+            }
+        }
+        if( final ) ajouter_etat_final( res, id_e );
+
+        // Une seule recherche par transition.
+        int l;
+        for( l=0; l<nb_lettres; l++ ){
+            int nb = ensembles.nb;
+            int id = interner_ligne( 
+                &ensembles, images + (size_t) l * largeur 
+            );
+            if( id == nb ) ajouter_etat( res, id );
+            ajouter_nouvelle_transition( res, id_e, lettres[l], id );
+        }
     }
+
+    xfree( courant );
+    liberer_lignes( &ensembles );
+    liberer_automate_fige( fige );
+    return res;
 }
 
-Automate * creer_automate_deterministe( const Automate* automate ){
-    Automate * res = creer_automate();
+/* 
+ * ===  FUNCTION  ======================================================================
+ *         Name:  creer_automate_minimal
+ *  Description:  create the minimal DFA based on the Brzozowski's algorithm
+ * =====================================================================================
+ */
+Automate * creer_automate_minimal( const Automate* automate ){
 
-    Fifo* f = creer_fifo();
-    Table* ensemble_to_id = creer_table(
-            ( int(*)(const intptr_t, const intptr_t) ) comparer_ensemble, 
-            ( intptr_t (*)( const intptr_t ) ) copier_ensemble,
-            ( void(*)(intptr_t) ) liberer_ensemble
-            );
-    Table* id_to_ensemble = creer_table( NULL, NULL, NULL );
+    //mirro deter mirro deter;
+    Automate * mir = miroir( automate );
+    Automate * det = creer_automate_deterministe( mir );
+    liberer_automate( mir );
+    mir = miroir( det );
+    liberer_automate( det );
+    Automate * res = creer_automate_deterministe( mir );
+    liberer_automate( mir );
+    return res;
 
-    int next_id = ajouter_ensemble(
-            copier_ensemble( get_initiaux( automate ) ), 
-            ensemble_to_id, id_to_ensemble, f, res, 0
-            );
-    ajouter_etat_initial( res, 0 );
+}
 
-    while( ! est_vide( f ) ){
-        Ensemble* e = (Ensemble*) retirer_fifo( f );
-        int id_e = get_valeur( trouver_table( ensemble_to_id, (intptr_t) e ) );
+/*
+ * Une partition des états 0..n-1 pour l'algorithme de Hopcroft : les états 
+ * de chaque classe sont rangés de façon contiguë dans 'elements', de 
+ * debut[c] à fin[c]-1, et les 'marques[c]' premiers sont marqués.
+ */
+typedef struct {
+    int nb_classes;
+    int * elements;
+    int * position;     //!< Position de chaque état dans 'elements'
+    int * classe;       //!< Classe de chaque état
+    int * debut;
+    int * fin;
+    int * marques;
+} Partition_hopcroft;
+
+void marquer_etat_hopcroft( 
+    Partition_hopcroft * p, int etat, int * touchees, int * nb_touchees 
+){
+    int c = p->classe[etat];
+    int i = p->position[etat];
+    int j = p->debut[c] + p->marques[c];
+    if( i < j ) return;   // Déjà marqué
+    int autre = p->elements[j];
+    p->elements[j] = etat;
+    p->position[etat] = j;
+    p->elements[i] = autre;
+    p->position[autre] = i;
+    if( p->marques[c]++ == 0 ) touchees[ (*nb_touchees)++ ] = c;
+}
 
-        Ensemble_iterateur it_lettre;
-        for(
-                it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
-                ! iterateur_ensemble_est_vide( it_lettre );
-                it_lettre = iterateur_suivant_ensemble( it_lettre )
-           ){
-            char lettre = (char) get_element( it_lettre );
-            Ensemble * img = delta( automate, e, lettre );
-            int id = ajouter_ensemble(
-                    img, ensemble_to_id, id_to_ensemble, f, res, next_id
-                    );
-            ajouter_transition(
-                    res, id_e, lettre, get_valeur(
-                        trouver_table( ensemble_to_id, (intptr_t) img ) 
-                        )
+/*
+ * Minimise l'automate déterministe complet d'états 0..n-1 et de k lettres, 
+ * dont les transitions sont 'delta' (n*k entrées). Renvoie le nombre de 
+ * classes, et range dans 'classe' celle de chaque état.
+ */
+int hopcroft( 
+    int n, int k, const int * delta, const unsigned char * finaux, int * classe 
+){
+    int i, l, t;
+
+    // Transitions inverses par lettre et par cible, au format CSR
+    int * debut_antecedents = xmalloc( ( (size_t) k * n + 1 ) * sizeof(int) );
+    int * antecedents = xmalloc( ( (size_t) k * n + 1 ) * sizeof(int) );
+    memset( debut_antecedents, 0, ( (size_t) k * n + 1 ) * sizeof(int) );
+    for( i=0; i<n; i++ ){
+        for( l=0; l<k; l++ ){
+            debut_antecedents[ (size_t) l * n + delta[ (size_t) i * k + l ] + 1 ]++;
+        }
+    }
+    for( t=0; t<k*n; t++ ){
+        debut_antecedents[t+1] += debut_antecedents[t];
+    }
+    int * remplissage = xmalloc( ( (size_t) k * n + 1 ) * sizeof(int) );
+    memcpy( remplissage, debut_antecedents, ( (size_t) k * n + 1 ) * sizeof(int) );
+    for( i=0; i<n; i++ ){
+        for( l=0; l<k; l++ ){
+            antecedents[ remplissage[ (size_t) l * n + delta[ (size_t) i * k + l ] ]++ ] = i;
+        }
+    }
+    xfree( remplissage );
+
+    // Partition initiale : les états finaux, puis les autres.
+    Partition_hopcroft p;
+    p.elements = xmalloc( ( n + 1 ) * sizeof(int) );
+    p.position = xmalloc( ( n + 1 ) * sizeof(int) );
+    p.classe = classe;
+    p.debut = xmalloc( ( n + 1 ) * sizeof(int) );
+    p.fin = xmalloc( ( n + 1 ) * sizeof(int) );
+    p.marques = xmalloc( ( n + 1 ) * sizeof(int) );
+    int nb_finaux = 0;
+    for( i=0; i<n; i++ ) nb_finaux += finaux[i];
+    int suivant[2] = { 0, nb_finaux };
+    for( i=0; i<n; i++ ){
+        int c = finaux[i] ? 0 : 1;
+        p.elements[ suivant[c] ] = i;
+        p.position[i] = suivant[c]++;
+    }
+    p.nb_classes = 0;
+    if( nb_finaux > 0 ){
+        p.debut[0] = 0;
+        p.fin[0] = nb_finaux;
+        p.nb_classes++;
+    }
+    if( nb_finaux < n ){
+        p.debut[ p.nb_classes ] = nb_finaux;
+        p.fin[ p.nb_classes ] = n;
+        p.nb_classes++;
+    }
+    for( i=0; i<n; i++ ){
+        classe[i] = ( finaux[i] || nb_finaux == 0 ) ? 0 : p.nb_classes - 1;
+    }
+    memset( p.marques, 0, ( n + 1 ) * sizeof(int) );
+
+    // Les séparateurs à traiter. Au départ, la plus petite des deux classes
+    // suffit.
+    int * separateurs = xmalloc( ( n + 1 ) * sizeof(int) );
+    unsigned char * est_separateur = xmalloc( n + 1 );
+    memset( est_separateur, 0, n + 1 );
+    int nb_separateurs = 0;
+    if( p.nb_classes == 2 ){
+        int c = nb_finaux <= n - nb_finaux ? 0 : 1;
+        separateurs[ nb_separateurs++ ] = c;
+        est_separateur[c] = 1;
+    }
+
+    int * copie = xmalloc( ( n + 1 ) * sizeof(int) );
+    int * touchees = xmalloc( ( n + 1 ) * sizeof(int) );
+    while( nb_separateurs > 0 ){
+        int s = separateurs[ --nb_separateurs ];
+        est_separateur[s] = 0;
+        // La classe 's' peut être coupée pendant son traitement : on garde
+        // ses états de départ.
+        int taille = p.fin[s] - p.debut[s];
+        memcpy( copie, p.elements + p.debut[s], taille * sizeof(int) );
+
+        for( l=0; l<k; l++ ){
+            int nb_touchees = 0;
+            for( i=0; i<taille; i++ ){
+                size_t cible = (size_t) l * n + copie[i];
+                for( 
+                    t = debut_antecedents[cible]; 
+                    t < debut_antecedents[cible+1]; 
+                    t++ 
+                ){
+                    marquer_etat_hopcroft( 
+                        &p, antecedents[t], touchees, &nb_touchees 
                     );
-            if( next_id == id ){
-                liberer_ensemble(img);
-            }else{
-                next_id = id;
+                }
             }
-        }
 
-        Ensemble_iterateur it_e;
-        for(
-                it_e = premier_iterateur_ensemble( e );
-                ! iterateur_ensemble_est_vide( it_e );
-                it_e = iterateur_suivant_ensemble( it_e )
-           ){
-            int elmt = get_element( it_e );
-            if(  est_un_etat_final_de_l_automate( automate, elmt ) ){
-                ajouter_etat_final( res, id_e );	
-                break;
+            // Les classes dont une partie seulement est marquée sont coupées :
+            // la partie marquée devient une nouvelle classe.
+            int j;
+            for( j=0; j<nb_touchees; j++ ){
+                int c = touchees[j];
+                int m = p.marques[c];
+                p.marques[c] = 0;
+                if( m == p.fin[c] - p.debut[c] ) continue;
+                int nouvelle = p.nb_classes++;
+                p.debut[nouvelle] = p.debut[c];
+                p.fin[nouvelle] = p.debut[c] + m;
+                p.debut[c] += m;
+                p.marques[nouvelle] = 0;
+                for( i = p.debut[nouvelle]; i < p.fin[nouvelle]; i++ ){
+                    classe[ p.elements[i] ] = nouvelle;
+                }
+                if( est_separateur[c] ){
+                    separateurs[ nb_separateurs++ ] = nouvelle;
+                    est_separateur[nouvelle] = 1;
+                }else{
+                    int plus_petite = 
+                        m <= p.fin[c] - p.debut[c] ? nouvelle : c;
+                    separateurs[ nb_separateurs++ ] = plus_petite;
+                    est_separateur[plus_petite] = 1;
+                }
             }
         }
+    }
+
+    xfree( copie );
+    xfree( touchees );
+    xfree( separateurs );
+    xfree( est_separateur );
+    xfree( p.elements );
+    xfree( p.position );
+    xfree( p.debut );
+    xfree( p.fin );
+    xfree( p.marques );
+    xfree( debut_antecedents );
+    xfree( antecedents );
+    return p.nb_classes;
+}
+
+Automate * creer_automate_minimal_hopcroft( const Automate* automate ){
+    Automate_fige * fige = figer_automate( automate );
+    int i, g, l;
 
+    int nb_initiaux = 0;
+    int deterministe = 1;
+    for( i=0; i<fige->nb_mots; i++ ){
+        nb_initiaux += __builtin_popcountll( fige->initiaux[i] );
+    }
+    for( g=0; g<fige->nb_groupes; g++ ){
+        if( fige->debut_cibles[g+1] - fige->debut_cibles[g] != 1 ){
+            deterministe = 0;
+        }
+    }
+    if( nb_initiaux > 1 || ! deterministe ){
+        liberer_automate_fige( fige );
+        Automate * det = creer_automate_deterministe( automate );
+        Automate * res = creer_automate_minimal_hopcroft( det );
+        liberer_automate( det );
+        return res;
     }
 
-    pour_toute_valeur_table(
-            id_to_ensemble,
-            ( void (*)(intptr_t valeur ) ) liberer_ensemble
-            );
-    liberer_table( id_to_ensemble );
-    liberer_table( ensemble_to_id );
+    // Les lettres de l'alphabet, dans l'ordre croissant
+    int k = 0;
+    int rang[256];
+    unsigned char lettres[256];
+    memset( rang, -1, sizeof(rang) );
+    Ensemble_iterateur it;
+    for(
+            it = premier_iterateur_ensemble( get_alphabet( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        unsigned char lettre = get_element( it );
+        if( rang[lettre] < 0 ){
+            rang[lettre] = k;
+            lettres[k++] = lettre;
+        }
+    }
 
-    liberer_fifo( f );
+    // L'automate complété : l'état n est le puits.
+    int n = fige->nb_etats + 1;
+    int puits = fige->nb_etats;
+    int * delta = xmalloc( ( (size_t) n * k + 1 ) * sizeof(int) );
+    unsigned char * finaux = xmalloc( n );
+    for( i=0; i < n * k; i++ ) delta[i] = puits;
+    int initial = puits;
+    for( i=0; i<fige->nb_etats; i++ ){
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            delta[ (size_t) i * k + rang[ fige->lettres[g] ] ] = 
+                fige->cibles[ fige->debut_cibles[g] ];
+        }
+        uint64_t bit = (uint64_t) 1 << ( i % 64 );
+        finaux[i] = ( fige->finaux[ i / 64 ] & bit ) != 0;
+        if( fige->initiaux[ i / 64 ] & bit ) initial = i;
+    }
+    finaux[puits] = 0;
+    liberer_automate_fige( fige );
+
+    int * classe = xmalloc( n * sizeof(int) );
+    int nb_classes = hopcroft( n, k, delta, finaux, classe );
+
+    // Un représentant par classe, puis numérotation en largeur des classes
+    // accessibles depuis celle de l'état initial.
+    int * representant = xmalloc( nb_classes * sizeof(int) );
+    int * numero = xmalloc( nb_classes * sizeof(int) );
+    int * file = xmalloc( nb_classes * sizeof(int) );
+    for( i=n-1; i>=0; i-- ) representant[ classe[i] ] = i;
+    for( i=0; i<nb_classes; i++ ) numero[i] = -1;
+    int nb = 0, tete = 0;
+    numero[ classe[initial] ] = nb++;
+    file[0] = classe[initial];
+
+    Automate * res = creer_automate();
+    ajouter_etat_initial( res, 0 );
+    while( tete < nb ){
+        int c = file[ tete++ ];
+        int origine = numero[c];
+        if( finaux[ representant[c] ] ) ajouter_etat_final( res, origine );
+        for( l=0; l<k; l++ ){
+            int cible = classe[ delta[ (size_t) representant[c] * k + l ] ];
+            if( numero[cible] < 0 ){
+                numero[cible] = nb;
+                file[ nb++ ] = cible;
+            }
+            ajouter_transition( res, origine, lettres[l], numero[cible] );
+        }
+    }
+
+    xfree( representant );
+    xfree( numero );
+    xfree( file );
+    xfree( classe );
+    xfree( delta );
+    xfree( finaux );
     return res;
 }
 
-/* 
- * ===  FUNCTION  ======================================================================
- *         Name:  creer_automate_minimal
- *  Description:  create the minimal DFA based on the Brzozowski's algorithm
- * =====================================================================================
+typedef struct {
+    Automate * res;
+    int puits;
+} data_retirer_puits_t;
+
+void action_retirer_puits( int origine, char lettre, int fin, void* data ){
+    data_retirer_puits_t * d = (data_retirer_puits_t*) data;
+    if( origine != d->puits && fin != d->puits ){
+        ajouter_transition( d->res, origine, lettre, fin );
+    }
+}
+
+/*
+ * Renvoie l'état puits d'un automate déterministe minimal complet : l'état 
+ * non final dont toutes les transitions bouclent. Renvoie -1 s'il n'y en a
+ * pas.
  */
-Automate * creer_automate_minimal( const Automate* automate ){
+int etat_puits_minimal( const Automate* minimal ){
+    int nb_lettres = taille_ensemble( get_alphabet( minimal ) );
+    Ensemble_iterateur it_etat, it_lettre;
+    for(
+            it_etat = premier_iterateur_ensemble( get_etats( minimal ) );
+            ! iterateur_ensemble_est_vide( it_etat );
+            it_etat = iterateur_suivant_ensemble( it_etat )
+       ){
+        int etat = get_element( it_etat );
+        if( est_un_etat_final_de_l_automate( minimal, etat ) ) continue;
+        int nb_boucles = 0;
+        for(
+                it_lettre = premier_iterateur_ensemble( get_alphabet( minimal ) );
+                ! iterateur_ensemble_est_vide( it_lettre );
+                it_lettre = iterateur_suivant_ensemble( it_lettre )
+           ){
+            nb_boucles += est_une_transition_de_l_automate( 
+                minimal, etat, get_element( it_lettre ), etat 
+            );
+        }
+        if( nb_boucles == nb_lettres ) return etat;
+    }
+    return -1;
+}
+
+Automate * creer_automate_canonique( const Automate* automate ){
+    Automate * minimal = creer_automate_minimal_hopcroft( automate );
+    int puits = etat_puits_minimal( minimal );
+    if( puits < 0 ) return minimal;
+
+    Automate * res = creer_automate();
+    if( puits == 0 ){
+        // Langage vide
+        ajouter_etat_initial( res, 0 );
+        liberer_automate( minimal );
+        return res;
+    }
+    Ensemble_iterateur it;
+    for(
+            it = premier_iterateur_ensemble( get_etats( minimal ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        int etat = get_element( it );
+        if( etat == puits ) continue;
+        ajouter_etat( res, etat );
+        if( est_un_etat_final_de_l_automate( minimal, etat ) ){
+            ajouter_etat_final( res, etat );
+        }
+    }
+    ajouter_etat_initial( res, 0 );
+    data_retirer_puits_t data = { res, puits };
+    pour_toute_transition( minimal, action_retirer_puits, &data );
+    liberer_automate( minimal );
+
+    // Sans le puits, les numéros ne se suivent plus : on renumérote dans 
+    // l'ordre du parcours en largeur.
+    Automate * canonique = renumeroter_automate( res, 1, NULL );
+    liberer_automate( res );
+    return canonique;
+}
+
+typedef struct {
+    const Automate * autre;
+    int egaux;
+} data_canoniques_egaux_t;
+
+void action_canoniques_egaux( int origine, char lettre, int fin, void* data ){
+    data_canoniques_egaux_t * d = (data_canoniques_egaux_t*) data;
+    if( ! est_une_transition_de_l_automate( d->autre, origine, lettre, fin ) ){
+        d->egaux = 0;
+    }
+}
+
+int automates_canoniques_egaux( const Automate* automate1, const Automate* automate2 ){
+    if( 
+        comparer_ensemble( get_etats( automate1 ), get_etats( automate2 ) ) 
+        || comparer_ensemble( get_initiaux( automate1 ), get_initiaux( automate2 ) )
+        || comparer_ensemble( get_finaux( automate1 ), get_finaux( automate2 ) )
+        || nombre_de_transitions( automate1 ) != nombre_de_transitions( automate2 )
+    ){
+        return 0;
+    }
+    data_canoniques_egaux_t data = { automate2, 1 };
+    pour_toute_transition( automate1, action_canoniques_egaux, &data );
+    return data.egaux;
+}
 
-    return creer_automate_deterministe(miroir(creer_automate_deterministe(miroir(automate))));//mirro deter mirro deter;
+Empreinte_langage empreinte_automate_canonique( const Automate* canonique ){
+    // L'automate figé range les transitions par origine, lettre et fin, et
+    // les états d'une forme canonique sont 0, 1, ..., n-1.
+    Automate_fige * fige = figer_automate( canonique );
+    Empreinte_langage res;
+    uint64_t h1 = hacher_entier( fige->nb_etats );
+    uint64_t h2 = hacher_entier( ~ (uint64_t) fige->nb_etats );
+    int i, g;
+    for( i=0; i<fige->nb_etats; i++ ){
+        uint64_t final = ( fige->finaux[ i / 64 ] >> ( i % 64 ) ) & 1;
+        h1 = hacher_entier( h1 ^ final );
+        h2 = hacher_entier( h2 + final * 0x9e3779b97f4a7c15ull + i );
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            uint64_t transition = 
+                ( (uint64_t) fige->lettres[g] << 32 ) 
+                | (uint32_t) fige->cibles[ fige->debut_cibles[g] ];
+            h1 = hacher_entier( h1 ^ transition );
+            h2 = hacher_entier( h2 + transition * 0x9e3779b97f4a7c15ull );
+        }
+        // Sépare les transitions de deux états consécutifs.
+        h1 = hacher_entier( h1 ^ 0xffffffffffffffffull );
+    }
+    liberer_automate_fige( fige );
+    res.mots[0] = h1;
+    res.mots[1] = h2;
+    return res;
+}
 
+Empreinte_langage empreinte_langage( const Automate* automate ){
+    Automate * canonique = creer_automate_canonique( automate );
+    Empreinte_langage res = empreinte_automate_canonique( canonique );
+    liberer_automate( canonique );
+    return res;
 }
 
+int empreintes_egales( Empreinte_langage e1, Empreinte_langage e2 ){
+    return e1.mots[0] == e2.mots[0] && e1.mots[1] == e2.mots[1];
+}
@@ -25,6 +25,9 @@
 
 #include "ensemble.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
 /**
  * @brief Le type d'un automate.
  * 
@@ -32,6 +35,9 @@
  * états sont des entiers codés par le 
  * type int. Les lettres sont codées par le type char, et l'automate n'accepte 
  * pas d'epsilon transition.
+ * Toutes les valeurs d'octet sont des lettres possibles, y compris '\0' : 
+ * une lettre est rangée dans l'alphabet et dans les transitions comme un 
+ * entier de 0 à 255 (sa valeur en unsigned char).
  * L'automate codé peut avoir plusieurs états initiaux.
  * 
  */
@@ -43,6 +49,7 @@ struct Automate {
 	Table* transitions;
 	Ensemble * initiaux;
 	Ensemble * finaux;
+	Arena * arena;   //!< Contient toute la mémoire de l'automate.
 };
 
 typedef struct Automate Automate;
@@ -253,6 +260,21 @@ Ensemble * delta_star(
 	const Automate* automate, const Ensemble * etats_courants, const char* mot
 );
 
+/**
+ * @brief Équivalent de delta_star() pour un mot de 'taille' octets, qui 
+ *        peut contenir des octets nuls.
+ *
+ * @param automate Un automate.
+ * @param etats_courants L'ensemble des état origines.
+ * @param mot Le mot à lire.
+ * @param taille Le nombre d'octets du mot.
+ * @return L'ensemble des états accessibles.
+ */ 
+Ensemble * delta_star_octets(
+	const Automate* automate, const Ensemble * etats_courants, 
+	const uint8_t* mot, size_t taille
+);
+
 /**
  * @brief Renvoie vrai si le mot passé en paramètre est reconu par l'automate 
  *        passé en paramètre, et renvoie 0 sinon.
@@ -263,6 +285,19 @@ Ensemble * delta_star(
  */ 
 int le_mot_est_reconnu( const Automate* automate, const char* mot );
 
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un mot de 'taille' 
+ *        octets, qui peut contenir des octets nuls.
+ *
+ * @param automate Un automate.
+ * @param mot Le mot à reconnaître.
+ * @param taille Le nombre d'octets du mot.
+ * @return 1 ou 0
+ */ 
+int le_mot_est_reconnu_octets( 
+	const Automate* automate, const uint8_t* mot, size_t taille 
+);
+
 /**
  * @brief La fonction passe en revue toutes les transitions de l'automate et 
  *        appelle la fonction passée en paramètre.
@@ -348,6 +383,32 @@ Ensemble* accessibles( const Automate * automate );
  */ 
 Automate *automate_accessible( const Automate * automate );
 
+/**
+ * @brief Renvoie une copie de l'automate dont les états sont numérotés de 0 
+ *        à n-1, où n est le nombre d'états.
+ *
+ * Si 'en_largeur' est vrai, les états accessibles sont numérotés dans l'ordre
+ * d'un parcours en largeur depuis les états initiaux (lettres et états 
+ * parcourus dans l'ordre croissant) : les états lus l'un après l'autre ont 
+ * ainsi des numéros proches. Les autres états, ou tous les états si 
+ * 'en_largeur' est faux, sont numérotés dans l'ordre croissant.
+ *
+ * Les tableaux indexés par les états (automate figé, système d'équations, 
+ * etc.) ont alors exactement n cases, alors que les numéros d'origine 
+ * peuvent être très grands (voir creer_intersection_des_automates()).
+ *
+ * @param automate Un automate.
+ * @param en_largeur 1 pour numéroter dans l'ordre d'un parcours en largeur, 
+ *                   0 pour garder l'ordre des numéros.
+ * @param correspondance Si ce pointeur n'est pas NULL, il reçoit une table 
+ *        qui associe à chaque ancien numéro le nouveau, à libérer avec 
+ *        liberer_table().
+ * @return L'automate renuméroté.
+ */ 
+Automate * renumeroter_automate( 
+	const Automate * automate, int en_largeur, Table ** correspondance 
+);
+
 /**
  * @brief @todo Renvoie l'automate miroir d'un automate.
  *
@@ -391,6 +452,90 @@ Automate * creer_automate_deterministe( const Automate* automate );
  */ 
 Automate * creer_automate_minimal( const Automate* automate );
 
+/**
+ * @brief Renvoie l'automate minimal, calculé par l'algorithme de Hopcroft.
+ *
+ * creer_automate_minimal() déterminise deux fois l'automate miroir 
+ * (algorithme de Brzozowski), ce qui peut coûter un temps exponentiel même
+ * quand l'automate est déjà déterministe. Ici, un automate déterministe est
+ * minimisé par raffinement de partition en O(k n log n) opérations, pour n 
+ * états et k lettres : on part de la partition {finaux, non finaux} et on 
+ * coupe les classes par les antécédents des classes d'une liste de 
+ * « séparateurs », en n'y ajoutant que la plus petite des deux moitiés de 
+ * chaque classe coupée. Un automate non déterministe est d'abord 
+ * déterminisé par creer_automate_deterministe().
+ *
+ * Comme celui de creer_automate_minimal(), le résultat est complet sur 
+ * l'alphabet de l'automate (un état puits est ajouté si besoin) et tous ses
+ * états sont accessibles. Ses états sont numérotés de 0 à n-1 dans l'ordre
+ * d'un parcours en largeur depuis l'état initial 0, les lettres étant 
+ * parcourues dans l'ordre croissant.
+ *
+ * @param automate L'automate à minimiser.
+ * @return L'automate minimal correspondant.
+ */ 
+Automate * creer_automate_minimal_hopcroft( const Automate* automate );
+
+/**
+ * @brief Renvoie la forme canonique du langage d'un automate.
+ *
+ * C'est l'automate déterministe minimal du langage, sans état puits : tous
+ * ses états sont accessibles et co-accessibles (sauf l'état initial 0 quand
+ * le langage est vide, qui reste seul et sans transition). Ses états sont 
+ * numérotés de 0 à n-1 dans l'ordre d'un parcours en largeur depuis l'état
+ * initial, les lettres étant parcourues dans l'ordre croissant.
+ *
+ * Deux automates reconnaissent donc le même langage si et seulement si 
+ * leurs formes canoniques sont identiques, état pour état et transition 
+ * pour transition, quels que soient leurs alphabets et leurs numérotations 
+ * (voir automates_canoniques_egaux()).
+ *
+ * @param automate Un automate.
+ * @return La forme canonique, calculée par creer_automate_minimal_hopcroft().
+ */ 
+Automate * creer_automate_canonique( const Automate* automate );
+
+/**
+ * @brief Renvoie 1 si deux formes canoniques sont identiques (mêmes états, 
+ *        même état initial, mêmes états finaux et mêmes transitions), et 0
+ *        sinon.
+ */ 
+int automates_canoniques_egaux( const Automate* automate1, const Automate* automate2 );
+
+/**
+ * @brief L'empreinte d'un langage, sur 128 bits.
+ */
+typedef struct Empreinte_langage {
+	uint64_t mots[2];
+} Empreinte_langage;
+
+/**
+ * @brief Calcule l'empreinte d'une forme canonique.
+ *
+ * L'empreinte est calculée à partir des états finaux et des transitions, 
+ * lus dans l'ordre des numéros d'états et des lettres. Deux automates de 
+ * même langage ont donc la même empreinte ; deux empreintes égales 
+ * désignent le même langage avec une très forte probabilité, que l'on 
+ * peut confirmer par automates_canoniques_egaux(). Les empreintes 
+ * permettent de ranger et de retrouver des langages dans une table de 
+ * hachage sans garder leurs automates.
+ *
+ * @param canonique Un automate renvoyé par creer_automate_canonique().
+ * @return L'empreinte.
+ */ 
+Empreinte_langage empreinte_automate_canonique( const Automate* canonique );
+
+/**
+ * @brief Calcule l'empreinte du langage d'un automate quelconque, en 
+ *        passant par sa forme canonique.
+ */ 
+Empreinte_langage empreinte_langage( const Automate* automate );
+
+/**
+ * @brief Renvoie 1 si deux empreintes sont égales, 0 sinon.
+ */ 
+int empreintes_egales( Empreinte_langage e1, Empreinte_langage e2 );
+
 /**
  * @brief Renvoie le nombre de transitions d'un automate.
  *
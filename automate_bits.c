@@ -0,0 +1,220 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_bits.h"
+#include "automate_fige.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Renvoie 1 si, dans l'automate figé, toutes les transitions qui arrivent
+ * sur un même état portent la même lettre. 'lettre_etat' reçoit la lettre
+ * de chaque état, ou -1 pour un état où n'arrive aucune transition.
+ */
+int est_homogene_fige( const Automate_fige * fige, int * lettre_etat ){
+    int i, g, k;
+    for( i=0; i<fige->nb_etats; i++ ) lettre_etat[i] = -1;
+    for( i=0; i<fige->nb_etats; i++ ){
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            for( k = fige->debut_cibles[g]; k < fige->debut_cibles[g+1]; k++ ){
+                int * lettre = &( lettre_etat[ fige->cibles[k] ] );
+                if( *lettre >= 0 && *lettre != fige->lettres[g] ) return 0;
+                *lettre = fige->lettres[g];
+            }
+        }
+    }
+    return 1;
+}
+
+Automate_bits * compiler_automate_bits( const Automate * automate ){
+    Automate_fige * fige = figer_automate( automate );
+    if( fige->nb_etats > NB_ETATS_MAX_BITS ){
+        liberer_automate_fige( fige );
+        return NULL;
+    }
+    int * lettre_etat = xmalloc( ( fige->nb_etats + 1 ) * sizeof(int) );
+    if( ! est_homogene_fige( fige, lettre_etat ) ){
+        xfree( lettre_etat );
+        liberer_automate_fige( fige );
+        return NULL;
+    }
+
+    Automate_bits * res = xmalloc( sizeof(Automate_bits) );
+    int n = fige->nb_etats;
+    int w = fige->nb_mots > 0 ? fige->nb_mots : 1;
+    int i, g, k, v;
+    res->nb_etats = n;
+    res->nb_mots = w;
+    res->nb_blocs = ( n + 7 ) / 8;
+
+    res->initiaux = xmalloc( w * sizeof(uint64_t) );
+    res->finaux = xmalloc( w * sizeof(uint64_t) );
+    memcpy( res->initiaux, fige->initiaux, w * sizeof(uint64_t) );
+    memcpy( res->finaux, fige->finaux, w * sizeof(uint64_t) );
+
+    res->lettres = xmalloc( 256 * w * sizeof(uint64_t) );
+    memset( res->lettres, 0, 256 * w * sizeof(uint64_t) );
+    for( i=0; i<n; i++ ){
+        if( lettre_etat[i] >= 0 ){
+            res->lettres[ lettre_etat[i] * w + i / 64 ] |= 
+                (uint64_t) 1 << ( i % 64 );
+        }
+    }
+    xfree( lettre_etat );
+
+    // suivants[b][v] = suivants[b][v sans son bit le plus faible] 
+    //                  | cibles de l'état de ce bit
+    size_t taille = (size_t) res->nb_blocs * 256 * w;
+    res->suivants = xmalloc( ( taille + 1 ) * sizeof(uint64_t) );
+    memset( res->suivants, 0, ( taille + 1 ) * sizeof(uint64_t) );
+    for( i=0; i<n; i++ ){
+        uint64_t * cibles_i = res->suivants 
+            + ( (size_t) ( i / 8 ) * 256 + ( 1 << ( i % 8 ) ) ) * w;
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            for( k = fige->debut_cibles[g]; k < fige->debut_cibles[g+1]; k++ ){
+                cibles_i[ fige->cibles[k] / 64 ] |= 
+                    (uint64_t) 1 << ( fige->cibles[k] % 64 );
+            }
+        }
+    }
+    int b;
+    for( b=0; b<res->nb_blocs; b++ ){
+        uint64_t * bloc = res->suivants + (size_t) b * 256 * w;
+        for( v=1; v<256; v++ ){
+            int faible = v & -v;
+            if( faible == v ) continue;
+            for( k=0; k<w; k++ ){
+                bloc[ v * w + k ] = 
+                    bloc[ ( v ^ faible ) * w + k ] | bloc[ faible * w + k ];
+            }
+        }
+    }
+
+    liberer_automate_fige( fige );
+    return res;
+}
+
+Automate_bits * compiler_rationnel_bits( Rationnel * rat ){
+    Automate * glushkov = Glushkov( rat );
+    Automate_bits * res = compiler_automate_bits( glushkov );
+    liberer_automate( glushkov );
+    return res;
+}
+
+void liberer_automate_bits( Automate_bits * automate ){
+    xfree( automate->suivants );
+    xfree( automate->lettres );
+    xfree( automate->initiaux );
+    xfree( automate->finaux );
+    xfree( automate );
+}
+
+/*
+ * Calcule dans 'suivants' les états atteints depuis ceux de 'courants' en
+ * lisant 'lettre'. Renvoie 0 si 'suivants' est vide.
+ */
+int etape_bits(
+    const Automate_bits * automate, const uint64_t * courants, 
+    unsigned char lettre, uint64_t * suivants
+){
+    int w = automate->nb_mots;
+    int m, k;
+    memset( suivants, 0, w * sizeof(uint64_t) );
+    for( m=0; m<w; m++ ){
+        uint64_t mot = courants[m];
+        while( mot ){
+            int octet = __builtin_ctzll( mot ) / 8;
+            int v = ( mot >> ( octet * 8 ) ) & 0xff;
+            mot &= ~( (uint64_t) 0xff << ( octet * 8 ) );
+            const uint64_t * cibles = 
+                automate->suivants + ( (size_t) ( m * 8 + octet ) * 256 + v ) * w;
+            for( k=0; k<w; k++ ){
+                suivants[k] |= cibles[k];
+            }
+        }
+    }
+    const uint64_t * masque = automate->lettres + lettre * w;
+    uint64_t non_vide = 0;
+    for( k=0; k<w; k++ ){
+        suivants[k] &= masque[k];
+        non_vide |= suivants[k];
+    }
+    return non_vide != 0;
+}
+
+/*
+ * le_mot_est_reconnu_bits() quand les états tiennent dans un mot : 
+ * l'ensemble des états courants reste dans une variable.
+ */
+int le_mot_est_reconnu_bits_1( 
+    const Automate_bits * automate, const uint8_t * mot, size_t taille
+){
+    const uint64_t * suivants = automate->suivants;
+    const uint64_t * lettres = automate->lettres;
+    const uint8_t * lettre = mot;
+    const uint8_t * fin = mot + taille;
+    uint64_t courants = automate->initiaux[0];
+    while( lettre < fin && courants ){
+        uint64_t cibles = 0;
+        int b;
+        for( b=0; courants; b++, courants >>= 8 ){
+            cibles |= suivants[ b * 256 + ( courants & 0xff ) ];
+        }
+        courants = cibles & lettres[ *lettre++ ];
+    }
+    return lettre == fin && ( courants & automate->finaux[0] );
+}
+
+int le_mot_est_reconnu_bits( const Automate_bits * automate, const char * mot ){
+    return le_mot_est_reconnu_bits_octets( 
+        automate, (const uint8_t*) mot, strlen( mot ) 
+    );
+}
+
+int le_mot_est_reconnu_bits_octets( 
+    const Automate_bits * automate, const uint8_t * mot, size_t taille 
+){
+    int w = automate->nb_mots;
+    if( w == 1 ) return le_mot_est_reconnu_bits_1( automate, mot, taille );
+    uint64_t * memoire = xmalloc( 2 * w * sizeof(uint64_t) );
+    uint64_t * courants = memoire;
+    uint64_t * tampon = memoire + w;
+    memcpy( courants, automate->initiaux, w * sizeof(uint64_t) );
+
+    const uint8_t * lettre;
+    const uint8_t * fin = mot + taille;
+    int result = 0;
+    for( lettre = mot; lettre < fin; lettre++ ){
+        if( ! etape_bits( automate, courants, *lettre, tampon ) ) break;
+        uint64_t * tmp = courants;
+        courants = tampon;
+        tampon = tmp;
+    }
+    if( lettre == fin ){
+        int k;
+        for( k=0; k<w; k++ ){
+            if( courants[k] & automate->finaux[k] ) result = 1;
+        }
+    }
+    xfree( memoire );
+    return result;
+}
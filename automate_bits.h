@@ -0,0 +1,117 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_bits.h */ 
+
+#ifndef __AUTOMATE_BITS_H__
+#define __AUTOMATE_BITS_H__
+
+#include "automate.h"
+#include "rationnel.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Nombre maximal d'états d'un Automate_bits.
+ */
+#define NB_ETATS_MAX_BITS 1024
+
+/**
+ * @brief Le type d'un automate simulé en parallèle sur les bits.
+ *
+ * Il s'applique aux automates dont toutes les transitions qui arrivent sur un
+ * même état portent la même lettre, comme les automates de Glushkov : l'état
+ * p (sauf l'état initial) correspond à une position de l'expression, et on ne
+ * l'atteint qu'en lisant la lettre de cette position. L'ensemble des états 
+ * atteints en lisant c depuis D est alors 
+ *     suivants(D) & lettres[c]
+ * où suivants(D) est l'union des cibles des états de D, quelle que soit la 
+ * lettre, et lettres[c] l'ensemble des états où arrivent les c-transitions.
+ * On n'a jamais besoin de déterminiser l'automate.
+ *
+ * Les ensembles d'états sont des tableaux de bits de nb_mots mots. Les 
+ * états sont renumérotés comme dans figer_automate(). Pour calculer 
+ * suivants(D) vite, les états sont groupés par blocs de 8 : 
+ * suivants[ ( b*256 + v ) * nb_mots ] est l'union des cibles des états du 
+ * bloc b dont les bits valent v. Lire une lettre coûte ainsi un OU de 
+ * nb_mots mots par bloc non vide de D, puis un ET.
+ *
+ * lettres[ c * nb_mots ] est le tableau de bits des états atteints par 'c'.
+ *
+ * La table 'suivants' a nb_blocs * 256 tableaux de nb_mots mots de 8 
+ * octets, soit environ 4 * nb_etats * nb_etats octets : on n'accepte donc 
+ * qu'au plus NB_ETATS_MAX_BITS états (4 Mo de table). 
+ * Au-delà, il faut se servir d'un automate paresseux ou d'une table dense.
+ */
+typedef struct Automate_bits {
+	int nb_etats;
+	int nb_mots;
+	int nb_blocs;          //!< ( nb_etats + 7 ) / 8
+	uint64_t * suivants;   //!< nb_blocs * 256 tableaux de bits
+	uint64_t * lettres;    //!< 256 tableaux de bits
+	uint64_t * initiaux;
+	uint64_t * finaux;
+} Automate_bits;
+
+/**
+ * @brief Compile un automate dont toutes les transitions qui arrivent sur un
+ *        même état portent la même lettre.
+ *
+ * L'automate d'origine peut ensuite être modifié ou détruit.
+ *
+ * @param automate Un automate, par exemple le résultat de Glushkov().
+ * @return L'automate compilé, à libérer avec liberer_automate_bits(), ou NULL
+ *         si deux transitions qui arrivent sur un même état portent des 
+ *         lettres différentes, ou si l'automate a plus de NB_ETATS_MAX_BITS
+ *         états.
+ */
+Automate_bits * compiler_automate_bits( const Automate * automate );
+
+/**
+ * @brief Compile l'automate de Glushkov d'une expression rationnelle.
+ *
+ * @param rat Une expression rationnelle.
+ * @return L'automate compilé, à libérer avec liberer_automate_bits(), ou NULL
+ *         si l'expression a plus de NB_ETATS_MAX_BITS - 1 positions (l'état
+ *         initial s'y ajoute).
+ */
+Automate_bits * compiler_rationnel_bits( Rationnel * rat );
+
+/**
+ * @brief Libère la mémoire d'un automate compilé.
+ */
+void liberer_automate_bits( Automate_bits * automate );
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un automate compilé.
+ *
+ * La lecture s'arrête dès que l'ensemble des états courants est vide.
+ */
+int le_mot_est_reconnu_bits( const Automate_bits * automate, const char * mot );
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu_bits() pour un mot de 'taille' 
+ *        octets, qui peut contenir des octets nuls.
+ */
+int le_mot_est_reconnu_bits_octets( 
+	const Automate_bits * automate, const uint8_t * mot, size_t taille 
+);
+
+#endif
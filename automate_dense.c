@@ -0,0 +1,241 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_dense.h"
+#include "automate_fige.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Renvoie un tableau de nb_etats entiers qui vaut 1 pour les états de 
+ * l'automate figé depuis lesquels on peut atteindre un état final, et 0 pour
+ * les autres. On parcourt les transitions à l'envers à partir des états 
+ * finaux.
+ */
+int * etats_utiles_fige( const Automate_fige * fige ){
+    int n = fige->nb_etats;
+    int i, g, k;
+
+    // Transitions inverses, au format CSR
+    int * debut_origines = xmalloc( ( n + 1 ) * sizeof(int) );
+    int * origines = xmalloc( ( fige->nb_transitions + 1 ) * sizeof(int) );
+    memset( debut_origines, 0, ( n + 1 ) * sizeof(int) );
+    for( k=0; k<fige->nb_transitions; k++ ){
+        debut_origines[ fige->cibles[k] + 1 ]++;
+    }
+    for( i=0; i<n; i++ ){
+        debut_origines[i+1] += debut_origines[i];
+    }
+    int * position = xmalloc( ( n + 1 ) * sizeof(int) );
+    memcpy( position, debut_origines, ( n + 1 ) * sizeof(int) );
+    for( i=0; i<n; i++ ){
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            for( k = fige->debut_cibles[g]; k < fige->debut_cibles[g+1]; k++ ){
+                origines[ position[ fige->cibles[k] ]++ ] = i;
+            }
+        }
+    }
+
+    // Parcours depuis les états finaux ; 'position' sert de pile.
+    int * utiles = xmalloc( ( n + 1 ) * sizeof(int) );
+    int nb_pile = 0;
+    for( i=0; i<n; i++ ){
+        utiles[i] = ( fige->finaux[ i / 64 ] >> ( i % 64 ) ) & 1;
+        if( utiles[i] ) position[ nb_pile++ ] = i;
+    }
+    while( nb_pile > 0 ){
+        int fin = position[ --nb_pile ];
+        for( k = debut_origines[fin]; k < debut_origines[fin+1]; k++ ){
+            if( ! utiles[ origines[k] ] ){
+                utiles[ origines[k] ] = 1;
+                position[ nb_pile++ ] = origines[k];
+            }
+        }
+    }
+
+    xfree( debut_origines );
+    xfree( origines );
+    xfree( position );
+    return utiles;
+}
+
+/*
+ * Renvoie 1 si l'automate figé a au plus un état initial et au plus une 
+ * cible par état et par lettre.
+ */
+int est_deterministe_fige( const Automate_fige * fige ){
+    int w, g;
+    int nb_initiaux = 0;
+    for( w=0; w<fige->nb_mots; w++ ){
+        nb_initiaux += __builtin_popcountll( fige->initiaux[w] );
+    }
+    if( nb_initiaux > 1 ) return 0;
+    for( g=0; g<fige->nb_groupes; g++ ){
+        if( fige->debut_cibles[g+1] - fige->debut_cibles[g] != 1 ) return 0;
+    }
+    return 1;
+}
+
+Automate_dense * compiler_automate( const Automate * automate ){
+    Automate_fige * fige = figer_automate( automate );
+    if( ! est_deterministe_fige( fige ) ){
+        liberer_automate_fige( fige );
+        return NULL;
+    }
+    int i, g, c, l;
+
+    // Les états utiles reçoivent les indices 1, 2, ... ; les autres sont 
+    // confondus avec le puits.
+    int * utiles = etats_utiles_fige( fige );
+    int * indices = xmalloc( ( fige->nb_etats + 1 ) * sizeof(int) );
+    int nb_etats = 1;
+    for( i=0; i<fige->nb_etats; i++ ){
+        indices[i] = utiles[i] ? nb_etats++ : 0;
+    }
+    xfree( utiles );
+
+    // Colonne de chaque lettre : l'indice atteint depuis chaque indice.
+    int nb_lettres = 0;
+    int rang[256];
+    memset( rang, -1, sizeof(rang) );
+    for( g=0; g<fige->nb_groupes; g++ ){
+        if( rang[ fige->lettres[g] ] < 0 ) rang[ fige->lettres[g] ] = nb_lettres++;
+    }
+    int * colonnes = xmalloc( ( nb_lettres * nb_etats + 1 ) * sizeof(int) );
+    memset( colonnes, 0, ( nb_lettres * nb_etats + 1 ) * sizeof(int) );
+    for( i=0; i<fige->nb_etats; i++ ){
+        if( ! indices[i] ) continue;
+        for( g = fige->debut_groupes[i]; g < fige->debut_groupes[i+1]; g++ ){
+            colonnes[ rang[ fige->lettres[g] ] * nb_etats + indices[i] ] = 
+                indices[ fige->cibles[ fige->debut_cibles[g] ] ];
+        }
+    }
+
+    // Les lettres qui ont la même colonne partagent une classe. La classe 0
+    // est celle de la colonne qui ne mène qu'au puits.
+    Automate_dense * res = xmalloc( sizeof(Automate_dense) );
+    int representant[257];
+    representant[0] = -1;
+    res->nb_classes = 1;
+    memset( res->classes, 0, sizeof(res->classes) );
+    for( l=0; l<256; l++ ){
+        if( rang[l] < 0 ) continue;
+        const int * colonne = colonnes + rang[l] * nb_etats;
+        for( c=0; c<res->nb_classes; c++ ){
+            if( representant[c] < 0 ){
+                for( i=0; i<nb_etats && colonne[i] == 0; i++ );
+                if( i == nb_etats ) break;
+            }else if( 
+                ! memcmp( 
+                    colonne, colonnes + representant[c] * nb_etats,
+                    nb_etats * sizeof(int)
+                )
+            ){
+                break;
+            }
+        }
+        if( c == res->nb_classes ){
+            representant[ res->nb_classes++ ] = rang[l];
+        }
+        res->classes[l] = c;
+    }
+
+    // La table, en décalages
+    res->nb_etats = nb_etats;
+    res->transitions = xmalloc( nb_etats * res->nb_classes * sizeof(int) );
+    for( i=0; i<nb_etats; i++ ){
+        res->transitions[ i * res->nb_classes ] = 0;
+        for( c=1; c<res->nb_classes; c++ ){
+            res->transitions[ i * res->nb_classes + c ] = 
+                colonnes[ representant[c] * nb_etats + i ] * res->nb_classes;
+        }
+    }
+    xfree( colonnes );
+
+    // L'état initial et les états finaux
+    res->initial = 0;
+    res->finaux = xmalloc( ( nb_etats / 64 + 1 ) * sizeof(uint64_t) );
+    memset( res->finaux, 0, ( nb_etats / 64 + 1 ) * sizeof(uint64_t) );
+    for( i=0; i<fige->nb_etats; i++ ){
+        uint64_t bit = (uint64_t) 1 << ( i % 64 );
+        if( fige->initiaux[ i / 64 ] & bit ){
+            res->initial = indices[i] * res->nb_classes;
+        }
+        if( fige->finaux[ i / 64 ] & bit ){
+            res->finaux[ indices[i] / 64 ] |= (uint64_t) 1 << ( indices[i] % 64 );
+        }
+    }
+    xfree( indices );
+    liberer_automate_fige( fige );
+    return res;
+}
+
+void liberer_automate_dense( Automate_dense * automate ){
+    xfree( automate->transitions );
+    xfree( automate->finaux );
+    xfree( automate );
+}
+
+int le_mot_est_reconnu_dense( 
+    const Automate_dense * automate, const char * mot 
+){
+    const int * transitions = automate->transitions;
+    const uint16_t * classes = automate->classes;
+    const unsigned char * lettre = (const unsigned char*) mot;
+    int etat = automate->initial;
+    while( *lettre && etat ){
+        etat = transitions[ etat + classes[ *lettre++ ] ];
+    }
+    if( *lettre ) return 0;
+    int indice = etat / automate->nb_classes;
+    return ( automate->finaux[ indice / 64 ] >> ( indice % 64 ) ) & 1;
+}
+
+void commencer_lecture_dense( 
+    Lecture_dense * lecture, const Automate_dense * automate 
+){
+    lecture->automate = automate;
+    lecture->etat = automate->initial;
+}
+
+void lire_morceau_dense( 
+    Lecture_dense * lecture, const char * morceau, size_t taille 
+){
+    const int * transitions = lecture->automate->transitions;
+    const uint16_t * classes = lecture->automate->classes;
+    const unsigned char * lettre = (const unsigned char*) morceau;
+    const unsigned char * fin = lettre + taille;
+    int etat = lecture->etat;
+    while( lettre < fin && etat ){
+        etat = transitions[ etat + classes[ *lettre++ ] ];
+    }
+    lecture->etat = etat;
+}
+
+int lecture_est_acceptante_dense( const Lecture_dense * lecture ){
+    int indice = lecture->etat / lecture->automate->nb_classes;
+    return ( lecture->automate->finaux[ indice / 64 ] >> ( indice % 64 ) ) & 1;
+}
+
+int terminer_lecture_dense( Lecture_dense * lecture ){
+    return lecture_est_acceptante_dense( lecture );
+}
@@ -0,0 +1,136 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_dense.h */ 
+
+#ifndef __AUTOMATE_DENSE_H__
+#define __AUTOMATE_DENSE_H__
+
+#include "automate.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Le type d'un automate déterministe compilé en table dense.
+ *
+ * On le construit une fois avec compiler_automate(), à partir d'un automate 
+ * déterministe (par exemple le résultat de creer_automate_deterministe()), 
+ * puis la lecture d'une lettre ne coûte plus qu'un accès à un tableau.
+ *
+ * Les octets sont répartis en nb_classes classes : deux lettres sont dans la
+ * même classe si elles ont le même effet sur tous les états, et les octets 
+ * qui ne sont pas des lettres de l'automate sont dans la classe 0. La 
+ * classe de l'octet c est classes[c]. Quand les 256 octets sont des lettres
+ * de colonnes toutes différentes, il y a 257 classes : elles ne tiennent 
+ * pas sur un octet.
+ *
+ * Un état est désigné par son « décalage » : son indice multiplié par 
+ * nb_classes. L'état atteint depuis le décalage e en lisant une lettre de 
+ * classe c est le décalage transitions[e + c] ; la boucle de lecture n'a 
+ * donc aucune multiplication à faire.
+ *
+ * L'état d'indice 0 (de décalage 0) est l'état puits : il n'est pas final et
+ * toutes ses transitions y reviennent. Tous les états de l'automate d'origine
+ * depuis lesquels on ne peut plus atteindre d'état final y sont confondus, 
+ * ce qui permet d'arrêter la lecture dès qu'on l'atteint.
+ *
+ * L'état d'indice i est final si le bit i%64 du mot i/64 de 'finaux' vaut 1.
+ */
+typedef struct Automate_dense {
+	int nb_etats;                //!< Nombre d'indices, puits compris
+	int nb_classes;
+	uint16_t classes[256];       //!< Classe de chaque octet
+	int * transitions;           //!< nb_etats*nb_classes décalages
+	int initial;                 //!< Décalage de l'état initial
+	uint64_t * finaux;
+} Automate_dense;
+
+/**
+ * @brief Compile un automate déterministe en table dense.
+ *
+ * L'automate doit avoir au plus un état initial et au plus une transition
+ * par état et par lettre. L'automate d'origine peut ensuite être modifié ou 
+ * détruit : l'automate compilé n'en dépend pas.
+ *
+ * @param automate Un automate déterministe.
+ * @return L'automate compilé, à libérer avec liberer_automate_dense(), ou 
+ *         NULL si l'automate n'est pas déterministe.
+ */
+Automate_dense * compiler_automate( const Automate * automate );
+
+/**
+ * @brief Libère la mémoire d'un automate compilé.
+ */
+void liberer_automate_dense( Automate_dense * automate );
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un automate compilé.
+ *
+ * La lecture s'arrête dès que l'état puits est atteint.
+ */
+int le_mot_est_reconnu_dense( 
+	const Automate_dense * automate, const char * mot 
+);
+
+/**
+ * @brief L'état d'une lecture morceau par morceau sur un automate compilé.
+ *
+ * Une lecture permet de reconnaître un mot reçu en plusieurs morceaux, sans
+ * jamais le recopier : on la commence avec commencer_lecture_dense(), on lui
+ * passe les morceaux dans l'ordre avec lire_morceau_dense(), puis on la 
+ * termine avec terminer_lecture_dense(). Elle n'alloue pas de mémoire et 
+ * peut être rangée sur la pile. Plusieurs lectures peuvent partager le même
+ * automate.
+ */
+typedef struct Lecture_dense {
+	const Automate_dense * automate;
+	int etat;                        //!< Décalage de l'état courant
+} Lecture_dense;
+
+/**
+ * @brief Commence la lecture d'un mot, à partir de l'état initial.
+ */
+void commencer_lecture_dense( 
+	Lecture_dense * lecture, const Automate_dense * automate 
+);
+
+/**
+ * @brief Lit les 'taille' octets de 'morceau', qui peuvent être nuls.
+ *
+ * Les octets ne sont lus qu'une fois, et ne sont plus lus du tout dès que 
+ * l'état puits est atteint.
+ */
+void lire_morceau_dense( 
+	Lecture_dense * lecture, const char * morceau, size_t taille 
+);
+
+/**
+ * @brief Renvoie 1 si le mot lu jusqu'ici est reconnu, 0 sinon.
+ */
+int lecture_est_acceptante_dense( const Lecture_dense * lecture );
+
+/**
+ * @brief Renvoie 1 si le mot lu jusqu'ici est reconnu, 0 sinon, et termine 
+ *        la lecture.
+ */
+int terminer_lecture_dense( Lecture_dense * lecture );
+
+#endif
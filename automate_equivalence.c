@@ -0,0 +1,480 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_equivalence.h"
+#include "automate_fige.h"
+#include "lignes.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Renvoie 1 si l'ensemble d'états (un tableau de bits) contient un état 
+ * final de l'automate.
+ */
+int contient_un_final( const Automate_fige * automate, const uint64_t * ensemble ){
+    int w;
+    for( w=0; w<automate->nb_mots; w++ ){
+        if( ensemble[w] & automate->finaux[w] ) return 1;
+    }
+    return 0;
+}
+
+/*
+ * Le déterminisé d'un des deux automates, construit à la demande. Les 
+ * transitions de l'état e sont transitions[e*nb_lettres ...], -1 tant 
+ * qu'elles ne sont pas calculées.
+ */
+typedef struct {
+    Automate_fige * fige;
+    int nb_mots;
+    Lignes ensembles;
+    int capacite;
+    int * transitions;
+    unsigned char * finaux;
+    uint64_t * courant;
+    uint64_t * suivant;
+} Determinise_equivalence;
+
+int ajouter_etat_equivalence( 
+    Determinise_equivalence * d, const uint64_t * ensemble, int nb_lettres 
+){
+    int nb = d->ensembles.nb;
+    int etat = interner_ligne( &( d->ensembles ), ensemble );
+    if( etat < nb ) return etat;
+
+    if( etat == d->capacite ){
+        d->capacite *= 2;
+        d->transitions = xrealloc( 
+            d->transitions, (size_t) d->capacite * nb_lettres * sizeof(int) 
+        );
+        d->finaux = xrealloc( d->finaux, d->capacite );
+    }
+    memset( 
+        d->transitions + (size_t) etat * nb_lettres, -1, 
+        nb_lettres * sizeof(int) 
+    );
+    d->finaux[etat] = contient_un_final( d->fige, ensemble );
+    return etat;
+}
+
+void initialiser_determinise_equivalence( 
+    Determinise_equivalence * d, const Automate * automate, int nb_lettres 
+){
+    d->fige = figer_automate( automate );
+    d->nb_mots = d->fige->nb_mots > 0 ? d->fige->nb_mots : 1;
+    initialiser_lignes( &( d->ensembles ), d->nb_mots );
+    d->capacite = 16;
+    d->transitions = xmalloc( 
+        (size_t) d->capacite * nb_lettres * sizeof(int) + 1 
+    );
+    d->finaux = xmalloc( d->capacite );
+    d->courant = xmalloc( 2 * d->nb_mots * sizeof(uint64_t) );
+    d->suivant = d->courant + d->nb_mots;
+    memset( d->courant, 0, 2 * d->nb_mots * sizeof(uint64_t) );
+    memcpy( d->courant, d->fige->initiaux, d->fige->nb_mots * sizeof(uint64_t) );
+    ajouter_etat_equivalence( d, d->courant, nb_lettres );
+}
+
+void liberer_determinise_equivalence( Determinise_equivalence * d ){
+    liberer_automate_fige( d->fige );
+    liberer_lignes( &( d->ensembles ) );
+    xfree( d->transitions );
+    xfree( d->finaux );
+    xfree( d->courant );
+}
+
+/*
+ * Renvoie l'état atteint depuis 'etat' par la lettre de rang 'rang'.
+ */
+int suivant_equivalence( 
+    Determinise_equivalence * d, int etat, int rang, unsigned char lettre,
+    int nb_lettres
+){
+    int * transition = d->transitions + (size_t) etat * nb_lettres + rang;
+    if( *transition >= 0 ) return *transition;
+    memcpy( 
+        d->courant, lire_ligne( &( d->ensembles ), etat ), 
+        d->nb_mots * sizeof(uint64_t) 
+    );
+    etape_fige( d->fige, d->courant, lettre, d->suivant );
+    int res = ajouter_etat_equivalence( d, d->suivant, nb_lettres );
+    // 'transitions' a pu être déplacé par ajouter_etat_equivalence().
+    d->transitions[ (size_t) etat * nb_lettres + rang ] = res;
+    return res;
+}
+
+/*
+ * Union-find sur les états des deux déterminisés : l'état e du premier est
+ * le sommet 2e, l'état e du second le sommet 2e+1.
+ */
+typedef struct {
+    int * parent;
+    int capacite;
+} Union_find;
+
+int trouver_representant( Union_find * u, int sommet ){
+    while( u->parent[sommet] != sommet ){
+        u->parent[sommet] = u->parent[ u->parent[sommet] ];
+        sommet = u->parent[sommet];
+    }
+    return sommet;
+}
+
+void ajouter_sommet( Union_find * u, int sommet ){
+    if( sommet >= u->capacite ){
+        int ancienne = u->capacite;
+        while( sommet >= u->capacite ) u->capacite *= 2;
+        u->parent = xrealloc( u->parent, u->capacite * sizeof(int) );
+        int i;
+        for( i=ancienne; i<u->capacite; i++ ) u->parent[i] = i;
+    }
+}
+
+/*
+ * Un couple du parcours, et le couple et la lettre par lesquels on l'a 
+ * atteint (pour reconstruire le contre-exemple).
+ */
+typedef struct {
+    int etat1;
+    int etat2;
+    int parent;
+    unsigned char lettre;
+} Couple_equivalence;
+
+int automates_equivalents( 
+    const Automate * automate1, const Automate * automate2, 
+    uint8_t ** contre_exemple, size_t * taille
+){
+    // L'union des alphabets
+    int nb_lettres = 0;
+    unsigned char lettres[256];
+    int presente[256];
+    memset( presente, 0, sizeof(presente) );
+    const Automate * automates[2] = { automate1, automate2 };
+    int i;
+    for( i=0; i<2; i++ ){
+        Ensemble_iterateur it;
+        for(
+                it = premier_iterateur_ensemble( get_alphabet( automates[i] ) );
+                ! iterateur_ensemble_est_vide( it );
+                it = iterateur_suivant_ensemble( it )
+           ){
+            unsigned char lettre = get_element( it );
+            if( ! presente[lettre] ){
+                presente[lettre] = 1;
+                lettres[ nb_lettres++ ] = lettre;
+            }
+        }
+    }
+
+    Determinise_equivalence d1, d2;
+    initialiser_determinise_equivalence( &d1, automate1, nb_lettres );
+    initialiser_determinise_equivalence( &d2, automate2, nb_lettres );
+
+    Union_find u;
+    u.capacite = 16;
+    u.parent = xmalloc( u.capacite * sizeof(int) );
+    for( i=0; i<u.capacite; i++ ) u.parent[i] = i;
+
+    int capacite = 16;
+    Couple_equivalence * couples = xmalloc( capacite * sizeof(Couple_equivalence) );
+    int nb_couples = 0;
+    int different = -1;     // Le couple distingué, s'il y en a un
+
+    // Les deux états initiaux ont le numéro 0.
+    couples[ nb_couples++ ] = (Couple_equivalence) { 0, 0, -1, 0 };
+    u.parent[1] = 0;
+    if( d1.finaux[0] != d2.finaux[0] ) different = 0;
+
+    int tete;
+    for( tete = 0; tete < nb_couples && different < 0; tete++ ){
+        int l;
+        for( l=0; l<nb_lettres && different < 0; l++ ){
+            int p = suivant_equivalence( 
+                &d1, couples[tete].etat1, l, lettres[l], nb_lettres 
+            );
+            int q = suivant_equivalence( 
+                &d2, couples[tete].etat2, l, lettres[l], nb_lettres 
+            );
+            ajouter_sommet( &u, 2 * p );
+            ajouter_sommet( &u, 2 * q + 1 );
+            int rp = trouver_representant( &u, 2 * p );
+            int rq = trouver_representant( &u, 2 * q + 1 );
+            if( rp == rq ) continue;
+            u.parent[rq] = rp;
+
+            if( nb_couples == capacite ){
+                capacite *= 2;
+                couples = xrealloc( 
+                    couples, capacite * sizeof(Couple_equivalence) 
+                );
+            }
+            couples[ nb_couples ] = 
+                (Couple_equivalence) { p, q, tete, lettres[l] };
+            if( d1.finaux[p] != d2.finaux[q] ) different = nb_couples;
+            nb_couples++;
+        }
+    }
+
+    if( different >= 0 && ( contre_exemple || taille ) ){
+        size_t longueur = 0;
+        int c;
+        for( c = different; couples[c].parent >= 0; c = couples[c].parent ){
+            longueur++;
+        }
+        if( taille ) *taille = longueur;
+        if( contre_exemple ){
+            *contre_exemple = xmalloc( longueur + 1 );
+            (*contre_exemple)[longueur] = '\0';
+            for( c = different; couples[c].parent >= 0; c = couples[c].parent ){
+                (*contre_exemple)[ --longueur ] = couples[c].lettre;
+            }
+        }
+    }
+
+    xfree( couples );
+    xfree( u.parent );
+    liberer_determinise_equivalence( &d1 );
+    liberer_determinise_equivalence( &d2 );
+    return different < 0;
+}
+
+/*
+ * Les couples (p, S) de langage_inclus(), rangés comme des lignes 
+ * [p, S] : le premier mot est l'état p, les 'largeur' suivants le tableau 
+ * de bits S. Un couple déjà vu n'est donc jamais comparé à l'antichaîne. Un
+ * couple couvert par l'antichaîne au moment où on le voit, ou retiré plus 
+ * tard par un couple plus petit du même état, est inactif : il reste rangé
+ * pour la reconstruction du contre-exemple.
+ */
+typedef struct {
+    int largeur;
+    Lignes couples;
+    int capacite;
+    int * parents;
+    unsigned char * lettres;
+    unsigned char * actifs;
+    int * cardinaux;
+    // L'antichaîne de chaque état p : les couples actifs (p, S).
+    int ** antichaines;
+    int * tailles;
+    int * capacites;
+} Couples_inclusion;
+
+int ensemble_inclus( const uint64_t * e1, const uint64_t * e2, int largeur ){
+    int w;
+    for( w=0; w<largeur; w++ ){
+        if( e1[w] & ~e2[w] ) return 0;
+    }
+    return 1;
+}
+
+/*
+ * Ajoute le couple 'couple' (une ligne [p, S]), sauf s'il est déjà vu ou 
+ * couvert par un couple actif. Renvoie le numéro du couple ajouté, ou -1.
+ */
+int ajouter_couple_inclusion( 
+    Couples_inclusion * c, const uint64_t * couple, 
+    int parent, unsigned char lettre
+){
+    int nb = c->couples.nb;
+    int numero = interner_ligne( &( c->couples ), couple );
+    if( numero < nb ) return -1;
+
+    if( numero == c->capacite ){
+        c->capacite *= 2;
+        c->parents = xrealloc( c->parents, c->capacite * sizeof(int) );
+        c->lettres = xrealloc( c->lettres, c->capacite );
+        c->actifs = xrealloc( c->actifs, c->capacite );
+        c->cardinaux = xrealloc( c->cardinaux, c->capacite * sizeof(int) );
+    }
+    c->parents[numero] = parent;
+    c->lettres[numero] = lettre;
+    c->actifs[numero] = 0;
+    const uint64_t * ensemble = couple + 1;
+    int cardinal = 0;
+    int w;
+    for( w=0; w<c->largeur; w++ ) cardinal += __builtin_popcountll( ensemble[w] );
+    c->cardinaux[numero] = cardinal;
+
+    // Un seul passage : si un couple de l'antichaîne est inclus dans le 
+    // nouveau, aucun ne le contient strictement (ce ne serait plus une 
+    // antichaîne), donc rien n'a encore été retiré.
+    int etat = couple[0];
+    int * antichaine = c->antichaines[etat];
+    int garde = 0;
+    int i;
+    for( i=0; i<c->tailles[etat]; i++ ){
+        int autre = antichaine[i];
+        const uint64_t * ensemble_autre = lire_ligne( &( c->couples ), autre ) + 1;
+        if( 
+            c->cardinaux[autre] <= cardinal 
+            && ensemble_inclus( ensemble_autre, ensemble, c->largeur ) 
+        ) return -1;
+        if( 
+            c->cardinaux[autre] > cardinal 
+            && ensemble_inclus( ensemble, ensemble_autre, c->largeur ) 
+        ){
+            c->actifs[autre] = 0;
+        }else{
+            antichaine[ garde++ ] = autre;
+        }
+    }
+    c->tailles[etat] = garde;
+    if( garde == c->capacites[etat] ){
+        c->capacites[etat] = 2 * garde + 4;
+        c->antichaines[etat] = xrealloc( 
+            c->antichaines[etat], c->capacites[etat] * sizeof(int) 
+        );
+    }
+    c->antichaines[etat][ c->tailles[etat]++ ] = numero;
+    c->actifs[numero] = 1;
+    return numero;
+}
+
+int langage_inclus( 
+    const Automate * automate1, const Automate * automate2, 
+    uint8_t ** contre_exemple, size_t * taille
+){
+    Automate_fige * fige1 = figer_automate( automate1 );
+    Automate_fige * fige2 = figer_automate( automate2 );
+
+    Couples_inclusion c;
+    c.largeur = fige2->nb_mots > 0 ? fige2->nb_mots : 1;
+    initialiser_lignes( &( c.couples ), c.largeur + 1 );
+    c.capacite = 16;
+    c.parents = xmalloc( c.capacite * sizeof(int) );
+    c.lettres = xmalloc( c.capacite );
+    c.actifs = xmalloc( c.capacite );
+    c.cardinaux = xmalloc( c.capacite * sizeof(int) );
+    c.antichaines = xmalloc( ( fige1->nb_etats + 1 ) * sizeof(int *) );
+    c.tailles = xmalloc( ( fige1->nb_etats + 1 ) * sizeof(int) );
+    c.capacites = xmalloc( ( fige1->nb_etats + 1 ) * sizeof(int) );
+    int p;
+    for( p=0; p<fige1->nb_etats; p++ ){
+        c.antichaines[p] = NULL;
+        c.tailles[p] = 0;
+        c.capacites[p] = 0;
+    }
+
+    // Deux lignes [p, S] : le couple courant et le couple suivant.
+    uint64_t * courant = xmalloc( 2 * ( c.largeur + 1 ) * sizeof(uint64_t) );
+    uint64_t * suivant = courant + c.largeur + 1;
+    memset( suivant, 0, ( c.largeur + 1 ) * sizeof(uint64_t) );
+    memcpy( suivant + 1, fige2->initiaux, fige2->nb_mots * sizeof(uint64_t) );
+    int final = contient_un_final( fige2, suivant + 1 );
+
+    int different = -1;     // Le couple (p, S) avec p final et S non final
+    for( p=0; p<fige1->nb_etats && different < 0; p++ ){
+        if( ! ( fige1->initiaux[p/64] >> (p%64) & 1 ) ) continue;
+        suivant[0] = p;
+        int numero = ajouter_couple_inclusion( &c, suivant, -1, 0 );
+        if( 
+            numero >= 0 && ! final && ( fige1->finaux[p/64] >> (p%64) & 1 )
+        ) different = numero;
+    }
+
+    int tete;
+    for( tete = 0; tete < c.couples.nb && different < 0; tete++ ){
+        if( ! c.actifs[tete] ) continue;
+        memcpy( 
+            courant, lire_ligne( &( c.couples ), tete ), 
+            ( c.largeur + 1 ) * sizeof(uint64_t) 
+        );
+        int etat = courant[0];
+        int g;
+        for( 
+            g = fige1->debut_groupes[etat]; 
+            g < fige1->debut_groupes[etat+1] && different < 0; 
+            g++ 
+        ){
+            unsigned char lettre = fige1->lettres[g];
+            etape_fige( fige2, courant + 1, lettre, suivant + 1 );
+            final = contient_un_final( fige2, suivant + 1 );
+            int t;
+            for( 
+                t = fige1->debut_cibles[g]; 
+                t < fige1->debut_cibles[g+1] && different < 0; 
+                t++ 
+            ){
+                int cible = fige1->cibles[t];
+                suivant[0] = cible;
+                int numero = ajouter_couple_inclusion( 
+                    &c, suivant, tete, lettre 
+                );
+                if( 
+                    numero >= 0 && ! final 
+                    && ( fige1->finaux[cible/64] >> (cible%64) & 1 )
+                ) different = numero;
+            }
+        }
+    }
+
+    if( different >= 0 && ( contre_exemple || taille ) ){
+        size_t longueur = 0;
+        int n;
+        for( n = different; c.parents[n] >= 0; n = c.parents[n] ){
+            longueur++;
+        }
+        if( taille ) *taille = longueur;
+        if( contre_exemple ){
+            *contre_exemple = xmalloc( longueur + 1 );
+            (*contre_exemple)[longueur] = '\0';
+            for( n = different; c.parents[n] >= 0; n = c.parents[n] ){
+                (*contre_exemple)[ --longueur ] = c.lettres[n];
+            }
+        }
+    }
+
+    for( p=0; p<fige1->nb_etats; p++ ) xfree( c.antichaines[p] );
+    xfree( c.antichaines );
+    xfree( c.tailles );
+    xfree( c.capacites );
+    liberer_lignes( &( c.couples ) );
+    xfree( c.parents );
+    xfree( c.lettres );
+    xfree( c.actifs );
+    xfree( c.cardinaux );
+    xfree( courant );
+    liberer_automate_fige( fige1 );
+    liberer_automate_fige( fige2 );
+    return different < 0;
+}
+
+int automate_universel( 
+    const Automate * automate, uint8_t ** contre_exemple, size_t * taille
+){
+    Automate * tout = creer_automate();
+    ajouter_etat_initial( tout, 0 );
+    ajouter_etat_final( tout, 0 );
+    Ensemble_iterateur it;
+    for(
+            it = premier_iterateur_ensemble( get_alphabet( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        ajouter_transition( tout, 0, get_element( it ), 0 );
+    }
+    int res = langage_inclus( tout, automate, contre_exemple, taille );
+    liberer_automate( tout );
+    return res;
+}
@@ -0,0 +1,114 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_equivalence.h */ 
+
+#ifndef __AUTOMATE_EQUIVALENCE_H__
+#define __AUTOMATE_EQUIVALENCE_H__
+
+#include "automate.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Teste si deux automates reconnaissent le même langage, et sinon 
+ *        donne un mot reconnu par un seul des deux.
+ *
+ * On utilise l'algorithme de Hopcroft et Karp : on parcourt en largeur les
+ * couples (p, q) d'états des déterminisés des deux automates atteints par 
+ * un même mot, à partir du couple des états initiaux. Les déterminisés ne 
+ * sont pas construits à l'avance : leurs états (des ensembles d'états, 
+ * codés par des tableaux de bits) sont créés au fur et à mesure qu'on les 
+ * atteint. Une structure union-find regroupe les états déjà supposés 
+ * équivalents : un couple dont les deux états sont déjà dans la même 
+ * classe n'est pas exploré de nouveau, ce qui limite le parcours à moins 
+ * de couples qu'il n'y a d'états dans les deux déterminisés.
+ *
+ * Le parcours s'arrête au premier couple dont un seul état est final : le
+ * mot qui y mène est un contre-exemple, et le plus court possible puisque 
+ * le parcours se fait en largeur. Aucun automate minimal n'est calculé.
+ *
+ * @param automate1 Un automate, déterministe ou non.
+ * @param automate2 Un automate, déterministe ou non.
+ * @param contre_exemple Si ce pointeur n'est pas NULL et que les langages 
+ *        sont différents, il reçoit un mot reconnu par un seul des deux 
+ *        automates, suivi d'un '\0', à libérer avec xfree().
+ * @param taille Si ce pointeur n'est pas NULL et que les langages sont 
+ *        différents, il reçoit la longueur du contre-exemple.
+ * @return 1 si les deux automates reconnaissent le même langage, 0 sinon.
+ */
+int automates_equivalents( 
+	const Automate * automate1, const Automate * automate2, 
+	uint8_t ** contre_exemple, size_t * taille
+);
+
+/**
+ * @brief Teste si le langage d'un automate est inclus dans celui d'un autre,
+ *        et sinon donne un mot reconnu par le premier et pas par le second.
+ *
+ * Le second automate n'est jamais déterminisé : on parcourt en largeur les 
+ * couples (p, S) où p est un état du premier automate et S l'ensemble des 
+ * états du second atteints par un même mot. Un couple (p, S) est inutile 
+ * s'il existe déjà un couple (p, T) avec T inclus dans S : tout mot qui 
+ * mène de (p, S) à un contre-exemple en donne aussi un depuis (p, T). On ne
+ * garde donc, pour chaque p, que les ensembles minimaux pour l'inclusion 
+ * (une « antichaîne »), ce qui évite le plus souvent l'explosion du nombre 
+ * de sous-ensembles.
+ *
+ * Le contre-exemple est le premier trouvé par le parcours ; il n'est pas 
+ * toujours le plus court.
+ *
+ * @param automate1 Un automate, déterministe ou non.
+ * @param automate2 Un automate, déterministe ou non.
+ * @param contre_exemple Si ce pointeur n'est pas NULL et que l'inclusion est
+ *        fausse, il reçoit un mot reconnu par automate1 et pas par 
+ *        automate2, suivi d'un '\0', à libérer avec xfree().
+ * @param taille Si ce pointeur n'est pas NULL et que l'inclusion est fausse,
+ *        il reçoit la longueur du contre-exemple.
+ * @return 1 si le langage de automate1 est inclus dans celui de automate2, 
+ *         0 sinon.
+ */
+int langage_inclus( 
+	const Automate * automate1, const Automate * automate2, 
+	uint8_t ** contre_exemple, size_t * taille
+);
+
+/**
+ * @brief Teste si un automate reconnaît tous les mots écrits sur son 
+ *        alphabet, et sinon donne un mot qu'il ne reconnaît pas.
+ *
+ * C'est langage_inclus() appliqué à l'automate à un état qui reconnaît 
+ * tous les mots de l'alphabet : seuls les ensembles d'états minimaux pour
+ * l'inclusion sont explorés.
+ *
+ * @param automate Un automate, déterministe ou non.
+ * @param contre_exemple Si ce pointeur n'est pas NULL et que l'automate 
+ *        n'est pas universel, il reçoit un mot qu'il ne reconnaît pas, suivi
+ *        d'un '\0', à libérer avec xfree().
+ * @param taille Si ce pointeur n'est pas NULL et que l'automate n'est pas 
+ *        universel, il reçoit la longueur du contre-exemple.
+ * @return 1 si l'automate reconnaît tous les mots de son alphabet, 0 sinon.
+ */
+int automate_universel( 
+	const Automate * automate, uint8_t ** contre_exemple, size_t * taille
+);
+
+#endif
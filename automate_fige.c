@@ -0,0 +1,393 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_fige.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Une transition, avec des indices d'états, utilisée pendant la 
+ * construction de l'automate figé.
+ */
+typedef struct {
+    int origine;
+    unsigned char lettre;
+    int fin;
+} Transition_figee;
+
+int comparer_transition_figee( const void* a, const void* b ){
+    const Transition_figee * t1 = (const Transition_figee*) a;
+    const Transition_figee * t2 = (const Transition_figee*) b;
+    if( t1->origine != t2->origine ) return t1->origine < t2->origine ? -1 : 1;
+    if( t1->lettre != t2->lettre ) return t1->lettre < t2->lettre ? -1 : 1;
+    if( t1->fin != t2->fin ) return t1->fin < t2->fin ? -1 : 1;
+    return 0;
+}
+
+typedef struct {
+    const Automate_fige * automate;
+    Transition_figee * transitions;
+    int nb_transitions;
+} data_collecter_transitions_t;
+
+void action_collecter_transition( int origine, char lettre, int fin, void* data ){
+    data_collecter_transitions_t * d = (data_collecter_transitions_t*) data;
+    Transition_figee * t = &( d->transitions[ d->nb_transitions++ ] );
+    t->origine = indice_etat_fige( d->automate, origine );
+    t->lettre = (unsigned char) lettre;
+    t->fin = indice_etat_fige( d->automate, fin );
+}
+
+void ajouter_bit_fige( uint64_t * mots, int indice ){
+    mots[ indice / 64 ] |= (uint64_t) 1 << ( indice % 64 );
+}
+
+typedef struct {
+    const Automate_fige * automate;
+    uint64_t * mots;
+} data_marquer_etat_t;
+
+void action_marquer_etat( const intptr_t element, void* data ){
+    data_marquer_etat_t * d = (data_marquer_etat_t*) data;
+    int indice = indice_etat_fige( d->automate, element );
+    if( indice >= 0 ) ajouter_bit_fige( d->mots, indice );
+}
+
+/*
+ * Met à 1, dans le tableau de bits 'mots', les bits des indices des états de
+ * 'ensemble' qui sont des états de l'automate.
+ */
+void marquer_etats( 
+    const Automate_fige * automate, const Ensemble * ensemble, uint64_t * mots 
+){
+    data_marquer_etat_t data = { automate, mots };
+    pour_tout_element( ensemble, action_marquer_etat, &data );
+}
+
+Automate_fige * figer_automate( const Automate * automate ){
+    Automate_fige * res = xmalloc( sizeof(Automate_fige) );
+    int i;
+
+    // Les états, dans l'ordre croissant
+    res->nb_etats = taille_ensemble( get_etats( automate ) );
+    res->etats = xmalloc( ( res->nb_etats + 1 ) * sizeof(int) );
+    Ensemble_iterateur it;
+    for(
+            i = 0, it = premier_iterateur_ensemble( get_etats( automate ) );
+            ! iterateur_ensemble_est_vide( it );
+            i++, it = iterateur_suivant_ensemble( it )
+       ){
+        res->etats[i] = get_element( it );
+    }
+
+    // Les transitions, triées par origine, lettre et fin
+    data_collecter_transitions_t data;
+    data.automate = res;
+    data.nb_transitions = 0;
+    data.transitions = xmalloc( 
+        ( nombre_de_transitions( automate ) + 1 ) * sizeof(Transition_figee) 
+    );
+    pour_toute_transition( automate, action_collecter_transition, &data );
+    qsort( 
+        data.transitions, data.nb_transitions, sizeof(Transition_figee),
+        comparer_transition_figee
+    );
+
+    res->nb_transitions = data.nb_transitions;
+    res->cibles = xmalloc( ( data.nb_transitions + 1 ) * sizeof(int) );
+    res->lettres = xmalloc( data.nb_transitions + 1 );
+    res->debut_cibles = xmalloc( ( data.nb_transitions + 1 ) * sizeof(int) );
+    res->debut_groupes = xmalloc( ( res->nb_etats + 1 ) * sizeof(int) );
+
+    int g = 0;
+    int origine = 0;
+    res->debut_groupes[0] = 0;
+    for( i=0; i<data.nb_transitions; i++ ){
+        const Transition_figee * t = &( data.transitions[i] );
+        if( 
+            i == 0 
+            || t->origine != data.transitions[i-1].origine
+            || t->lettre != data.transitions[i-1].lettre
+        ){
+            // Début d'un nouveau groupe
+            while( origine < t->origine ){
+                res->debut_groupes[ ++origine ] = g;
+            }
+            res->lettres[g] = t->lettre;
+            res->debut_cibles[g] = i;
+            g++;
+        }
+        res->cibles[i] = t->fin;
+    }
+    while( origine < res->nb_etats ){
+        res->debut_groupes[ ++origine ] = g;
+    }
+    res->nb_groupes = g;
+    res->debut_cibles[g] = data.nb_transitions;
+    xfree( data.transitions );
+
+    // Les états initiaux et finaux
+    res->nb_mots = ( res->nb_etats + 63 ) / 64;
+    res->initiaux = xmalloc( ( res->nb_mots + 1 ) * sizeof(uint64_t) );
+    res->finaux = xmalloc( ( res->nb_mots + 1 ) * sizeof(uint64_t) );
+    memset( res->initiaux, 0, ( res->nb_mots + 1 ) * sizeof(uint64_t) );
+    memset( res->finaux, 0, ( res->nb_mots + 1 ) * sizeof(uint64_t) );
+    marquer_etats( res, get_initiaux( automate ), res->initiaux );
+    marquer_etats( res, get_finaux( automate ), res->finaux );
+
+    return res;
+}
+
+void liberer_automate_fige( Automate_fige * automate ){
+    xfree( automate->etats );
+    xfree( automate->debut_groupes );
+    xfree( automate->lettres );
+    xfree( automate->debut_cibles );
+    xfree( automate->cibles );
+    xfree( automate->initiaux );
+    xfree( automate->finaux );
+    xfree( automate );
+}
+
+int indice_etat_fige( const Automate_fige * automate, int etat ){
+    int debut = 0, fin = automate->nb_etats;
+    while( debut < fin ){
+        int milieu = debut + ( fin - debut ) / 2;
+        if( automate->etats[milieu] < etat ){
+            debut = milieu + 1;
+        }else{
+            fin = milieu;
+        }
+    }
+    if( debut < automate->nb_etats && automate->etats[debut] == etat ){
+        return debut;
+    }
+    return -1;
+}
+
+int voisins_fige(
+    const Automate_fige * automate, int indice, unsigned char lettre,
+    const int ** cibles
+){
+    // Recherche dichotomique de la lettre parmi les groupes de l'état
+    int debut = automate->debut_groupes[indice];
+    int fin = automate->debut_groupes[indice+1];
+    while( debut < fin ){
+        int milieu = debut + ( fin - debut ) / 2;
+        if( automate->lettres[milieu] < lettre ){
+            debut = milieu + 1;
+        }else{
+            fin = milieu;
+        }
+    }
+    if( 
+        debut == automate->debut_groupes[indice+1] 
+        || automate->lettres[debut] != lettre 
+    ){
+        *cibles = NULL;
+        return 0;
+    }
+    *cibles = automate->cibles + automate->debut_cibles[debut];
+    return automate->debut_cibles[debut+1] - automate->debut_cibles[debut];
+}
+
+int etape_fige(
+    const Automate_fige * automate, const uint64_t * courants, 
+    unsigned char lettre, uint64_t * suivants
+){
+    int w, k;
+    uint64_t non_vide = 0;
+    memset( suivants, 0, automate->nb_mots * sizeof(uint64_t) );
+    for( w=0; w<automate->nb_mots; w++ ){
+        uint64_t mot = courants[w];
+        while( mot ){
+            int indice = w * 64 + __builtin_ctzll( mot );
+            mot &= mot - 1;
+            const int * cibles;
+            int n = voisins_fige( automate, indice, lettre, &cibles );
+            for( k=0; k<n; k++ ){
+                ajouter_bit_fige( suivants, cibles[k] );
+            }
+            non_vide |= n;
+        }
+    }
+    return non_vide != 0;
+}
+
+Ensemble * delta_fige(
+    const Automate_fige * automate, const Ensemble * etats_courants, char lettre
+){
+    Ensemble * res = creer_ensemble_semblable( etats_courants );
+    Ensemble_iterateur it;
+    int k;
+    for( 
+            it = premier_iterateur_ensemble( etats_courants );
+            ! iterateur_ensemble_est_vide( it );
+            it = iterateur_suivant_ensemble( it )
+       ){
+        int indice = indice_etat_fige( automate, get_element( it ) );
+        if( indice < 0 ) continue;
+        const int * cibles;
+        int n = voisins_fige( automate, indice, lettre, &cibles );
+        for( k=0; k<n; k++ ){
+            ajouter_element( res, automate->etats[ cibles[k] ] );
+        }
+    }
+    return res;
+}
+
+/*
+ * Lit le mot à partir des états de 'courants' : à la fin, 'courants' 
+ * contient les états atteints. 'tampon' doit avoir la même taille.
+ */
+void lire_mot_fige( 
+    const Automate_fige * automate, const char * mot, 
+    uint64_t ** courants, uint64_t ** tampon
+){
+    const unsigned char * lettre;
+    for( lettre = (const unsigned char*) mot; *lettre; lettre++ ){
+        int non_vide = etape_fige( automate, *courants, *lettre, *tampon );
+        uint64_t * tmp = *courants;
+        *courants = *tampon;
+        *tampon = tmp;
+        if( ! non_vide ) return;
+    }
+}
+
+Ensemble * delta_star_fige(
+    const Automate_fige * automate, const Ensemble * etats_courants, 
+    const char * mot
+){
+    if( ! *mot ) return copier_ensemble( etats_courants );
+
+    size_t taille = ( automate->nb_mots + 1 ) * sizeof(uint64_t);
+    uint64_t * courants = xmalloc( taille );
+    uint64_t * tampon = xmalloc( taille );
+    memset( courants, 0, taille );
+    marquer_etats( automate, etats_courants, courants );
+    lire_mot_fige( automate, mot, &courants, &tampon );
+
+    // Les indices sont parcourus dans l'ordre croissant : les éléments sont
+    // ajoutés à la fin du tableau.
+    Ensemble * res = creer_ensemble_tableau( NULL, NULL, NULL );
+    int w;
+    for( w=0; w<automate->nb_mots; w++ ){
+        uint64_t m = courants[w];
+        while( m ){
+            ajouter_element( res, automate->etats[ w*64 + __builtin_ctzll(m) ] );
+            m &= m - 1;
+        }
+    }
+    xfree( courants );
+    xfree( tampon );
+    return res;
+}
+
+int le_mot_est_reconnu_fige( const Automate_fige * automate, const char * mot ){
+    size_t taille = ( automate->nb_mots + 1 ) * sizeof(uint64_t);
+    uint64_t * courants = xmalloc( taille );
+    uint64_t * tampon = xmalloc( taille );
+    memcpy( courants, automate->initiaux, taille );
+    lire_mot_fige( automate, mot, &courants, &tampon );
+
+    int w;
+    int result = 0;
+    for( w=0; w<automate->nb_mots; w++ ){
+        if( courants[w] & automate->finaux[w] ){
+            result = 1;
+            break;
+        }
+    }
+    xfree( courants );
+    xfree( tampon );
+    return result;
+}
+
+void pour_toute_transition_fige(
+    const Automate_fige * automate,
+    void (* action )( int origine, char lettre, int fin, void* data ),
+    void* data
+){
+    int i, g, k;
+    for( i=0; i<automate->nb_etats; i++ ){
+        for( 
+                g = automate->debut_groupes[i]; 
+                g < automate->debut_groupes[i+1]; 
+                g++ 
+           ){
+            for( 
+                    k = automate->debut_cibles[g]; 
+                    k < automate->debut_cibles[g+1]; 
+                    k++ 
+               ){
+                action( 
+                    automate->etats[i], (char) automate->lettres[g], 
+                    automate->etats[ automate->cibles[k] ], data 
+                );
+            }
+        }
+    }
+}
+
+void commencer_lecture_fige( 
+    Lecture_fige * lecture, const Automate_fige * automate 
+){
+    size_t taille = ( automate->nb_mots + 1 ) * sizeof(uint64_t);
+    lecture->automate = automate;
+    lecture->courants = xmalloc( taille );
+    lecture->tampon = xmalloc( taille );
+    memcpy( lecture->courants, automate->initiaux, taille );
+    lecture->vide = 0;
+}
+
+void lire_morceau_fige( 
+    Lecture_fige * lecture, const char * morceau, size_t taille 
+){
+    const unsigned char * lettre = (const unsigned char*) morceau;
+    const unsigned char * fin = lettre + taille;
+    for( ; lettre < fin && ! lecture->vide; lettre++ ){
+        lecture->vide = ! etape_fige( 
+            lecture->automate, lecture->courants, *lettre, lecture->tampon 
+        );
+        uint64_t * tmp = lecture->courants;
+        lecture->courants = lecture->tampon;
+        lecture->tampon = tmp;
+    }
+}
+
+int lecture_est_acceptante_fige( const Lecture_fige * lecture ){
+    int w;
+    if( lecture->vide ) return 0;
+    for( w=0; w<lecture->automate->nb_mots; w++ ){
+        if( lecture->courants[w] & lecture->automate->finaux[w] ) return 1;
+    }
+    return 0;
+}
+
+int terminer_lecture_fige( Lecture_fige * lecture ){
+    int result = lecture_est_acceptante_fige( lecture );
+    xfree( lecture->courants );
+    xfree( lecture->tampon );
+    lecture->courants = NULL;
+    lecture->tampon = NULL;
+    return result;
+}
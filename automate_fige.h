@@ -0,0 +1,205 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_fige.h */ 
+
+#ifndef __AUTOMATE_FIGE_H__
+#define __AUTOMATE_FIGE_H__
+
+#include "automate.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Le type d'un automate figé.
+ *
+ * Un automate figé est une copie en lecture seule d'un automate, rangée 
+ * dans des tableaux contigus (format CSR, « compressed sparse row ») :
+ * on le construit une fois avec figer_automate(), puis on peut l'interroger
+ * autant de fois que l'on veut sans parcourir d'arbre ni de table.
+ *
+ * Les états sont renumérotés de 0 à nb_etats-1 dans l'ordre croissant de 
+ * leurs numéros d'origine, que l'on retrouve dans 'etats'. Dans la suite,
+ * l'« indice » d'un état désigne ce nouveau numéro.
+ *
+ * Les transitions de l'état d'indice i sont regroupées par lettre : les 
+ * groupes de i sont les groupes d'indices debut_groupes[i] à 
+ * debut_groupes[i+1]-1, rangés par lettre croissante. Le groupe g correspond
+ * à la lettre lettres[g] et ses cibles sont les indices 
+ * cibles[debut_cibles[g]] à cibles[debut_cibles[g+1]-1], rangés dans 
+ * l'ordre croissant.
+ *
+ * Les états initiaux et finaux sont codés par des tableaux de bits de 
+ * nb_mots mots : l'état d'indice i est initial si le bit i%64 du mot i/64 de
+ * 'initiaux' vaut 1.
+ */
+typedef struct Automate_fige {
+	int nb_etats;
+	int * etats;             //!< Numéro d'origine de chaque indice
+	int * debut_groupes;     //!< nb_etats+1 entrées
+	int nb_groupes;
+	unsigned char * lettres; //!< Lettre de chaque groupe
+	int * debut_cibles;      //!< nb_groupes+1 entrées
+	int nb_transitions;
+	int * cibles;            //!< Indices des états cibles
+	int nb_mots;
+	uint64_t * initiaux;
+	uint64_t * finaux;
+} Automate_fige;
+
+/**
+ * @brief Construit l'automate figé d'un automate.
+ *
+ * L'automate d'origine peut ensuite être modifié ou détruit : l'automate 
+ * figé n'en dépend pas.
+ *
+ * @param automate Un automate.
+ * @return L'automate figé, à libérer avec liberer_automate_fige().
+ */
+Automate_fige * figer_automate( const Automate * automate );
+
+/**
+ * @brief Libère la mémoire d'un automate figé.
+ */
+void liberer_automate_fige( Automate_fige * automate );
+
+/**
+ * @brief Renvoie l'indice de l'état dont le numéro d'origine est passé en 
+ *        paramètre, ou -1 si l'automate n'a pas cet état.
+ */
+int indice_etat_fige( const Automate_fige * automate, int etat );
+
+/**
+ * @brief Renvoie les états cibles d'un état et d'une lettre.
+ *
+ * '*cibles' pointe sur le premier indice cible, dans les tableaux de 
+ * l'automate : il ne faut ni le modifier ni le libérer.
+ *
+ * @param automate Un automate figé.
+ * @param indice L'indice de l'état d'origine.
+ * @param lettre Une lettre.
+ * @param cibles Reçoit l'adresse des indices des cibles.
+ * @return Le nombre de cibles.
+ */
+int voisins_fige(
+	const Automate_fige * automate, int indice, unsigned char lettre,
+	const int ** cibles
+);
+
+/**
+ * @brief Calcule dans 'suivants' les indices des états atteints depuis ceux 
+ *        de 'courants' en lisant 'lettre'.
+ *
+ * 'courants' et 'suivants' sont des tableaux de bits de nb_mots mots, codés
+ * comme 'initiaux'.
+ *
+ * @return 0 si 'suivants' est vide, 1 sinon.
+ */
+int etape_fige(
+	const Automate_fige * automate, const uint64_t * courants, 
+	unsigned char lettre, uint64_t * suivants
+);
+
+/**
+ * @brief Équivalent de delta() pour un automate figé.
+ *
+ * Les états de 'etats_courants' et de l'ensemble renvoyé sont les numéros
+ * d'origine. La mémoire de l'ensemble renvoyé est laissée à la charge de 
+ * l'utilisateur.
+ */
+Ensemble * delta_fige(
+	const Automate_fige * automate, const Ensemble * etats_courants, char lettre
+);
+
+/**
+ * @brief Équivalent de delta_star() pour un automate figé.
+ *
+ * Le calcul se fait sur deux tableaux de bits alloués une fois pour toutes.
+ * La mémoire de l'ensemble renvoyé est laissée à la charge de l'utilisateur.
+ */
+Ensemble * delta_star_fige(
+	const Automate_fige * automate, const Ensemble * etats_courants, 
+	const char * mot
+);
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un automate figé.
+ *
+ * La lecture s'arrête dès que l'ensemble des états courants est vide.
+ */
+int le_mot_est_reconnu_fige( const Automate_fige * automate, const char * mot );
+
+/**
+ * @brief L'état d'une lecture morceau par morceau sur un automate figé.
+ *
+ * Une lecture permet de reconnaître un mot reçu en plusieurs morceaux, sans
+ * jamais le recopier : on la commence avec commencer_lecture_fige(), on lui 
+ * passe les morceaux dans l'ordre avec lire_morceau_fige(), puis on la 
+ * termine avec terminer_lecture_fige(), qui libère ses tableaux. La mémoire
+ * utilisée ne dépend que du nombre d'états, pas de la longueur du mot.
+ */
+typedef struct Lecture_fige {
+	const Automate_fige * automate;
+	uint64_t * courants;             //!< Tableau de bits des états courants
+	uint64_t * tampon;
+	int vide;                        //!< 1 si aucun état n'est actif
+} Lecture_fige;
+
+/**
+ * @brief Commence la lecture d'un mot, à partir des états initiaux.
+ */
+void commencer_lecture_fige( 
+	Lecture_fige * lecture, const Automate_fige * automate 
+);
+
+/**
+ * @brief Lit les 'taille' octets de 'morceau', qui peuvent être nuls.
+ *
+ * La lecture s'arrête dès que l'ensemble des états courants est vide.
+ */
+void lire_morceau_fige( 
+	Lecture_fige * lecture, const char * morceau, size_t taille 
+);
+
+/**
+ * @brief Renvoie 1 si le mot lu jusqu'ici est reconnu, 0 sinon.
+ */
+int lecture_est_acceptante_fige( const Lecture_fige * lecture );
+
+/**
+ * @brief Renvoie 1 si le mot lu jusqu'ici est reconnu, 0 sinon, et libère 
+ *        la mémoire de la lecture.
+ */
+int terminer_lecture_fige( Lecture_fige * lecture );
+
+/**
+ * @brief Équivalent de pour_toute_transition() pour un automate figé.
+ *
+ * Les transitions sont parcourues par origine, puis lettre, puis fin 
+ * croissantes. Les états passés à 'action' sont les numéros d'origine.
+ */
+void pour_toute_transition_fige(
+	const Automate_fige * automate,
+	void (* action )( int origine, char lettre, int fin, void* data ),
+	void* data
+);
+
+#endif
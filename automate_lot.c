@@ -0,0 +1,236 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_lot.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Nombre de mots lus en même temps sur une table dense.
+ */
+#define NB_ENTRELACES 8
+
+Automate_lot * preparer_automate_lot( const Automate * automate ){
+    Automate_lot * res = xmalloc( sizeof(Automate_lot) );
+    res->dense = compiler_automate( automate );
+    res->fige = res->dense ? NULL : figer_automate( automate );
+    return res;
+}
+
+void liberer_automate_lot( Automate_lot * automate ){
+    if( automate->dense ) liberer_automate_dense( automate->dense );
+    if( automate->fige ) liberer_automate_fige( automate->fige );
+    xfree( automate );
+}
+
+void ecrire_resultat_lot( uint64_t * resultats, size_t i, int reconnu ){
+    uint64_t bit = (uint64_t) 1 << ( i % 64 );
+    if( reconnu ){
+        resultats[ i / 64 ] |= bit;
+    }else{
+        resultats[ i / 64 ] &= ~bit;
+    }
+}
+
+/*
+ * Lit les mots d'indices 'debut' à 'fin'-1 sur la table dense. Chacune des
+ * NB_ENTRELACES cases lit un mot ; dès qu'un mot est fini, la case prend le 
+ * mot suivant du lot.
+ */
+void reconnaitre_lot_dense(
+    const Automate_dense * automate, 
+    const uint8_t * const * mots, const size_t * tailles, 
+    size_t debut, size_t fin, uint64_t * resultats
+){
+    const int * transitions = automate->transitions;
+    const uint16_t * classes = automate->classes;
+    // Une case est active tant qu'elle a un mot ; 'restant' est le nombre de
+    // lettres de ce mot qui restent à lire (on ne calcule jamais NULL + 0
+    // pour un mot vide).
+    const uint8_t * lettre[NB_ENTRELACES];
+    size_t restant[NB_ENTRELACES];
+    int active[NB_ENTRELACES];
+    int etat[NB_ENTRELACES];
+    size_t indice[NB_ENTRELACES];
+    size_t suivant = debut;
+    int nb_actives = 0;
+    int k;
+
+    for( k=0; k<NB_ENTRELACES; k++ ){
+        if( suivant < fin ){
+            indice[k] = suivant;
+            lettre[k] = mots[suivant];
+            restant[k] = tailles[suivant];
+            etat[k] = automate->initial;
+            active[k] = 1;
+            suivant++;
+            nb_actives++;
+        }else{
+            lettre[k] = NULL;
+            restant[k] = 0;
+            etat[k] = 0;
+            active[k] = 0;
+        }
+    }
+
+    while( nb_actives > 0 ){
+        for( k=0; k<NB_ENTRELACES; k++ ){
+            if( restant[k] && etat[k] ){
+                etat[k] = transitions[ etat[k] + classes[ *lettre[k]++ ] ];
+                restant[k]--;
+                continue;
+            }
+            if( ! active[k] ) continue;
+
+            // Le mot de la case k est lu : on passe au suivant.
+            int i = etat[k] / automate->nb_classes;
+            ecrire_resultat_lot( 
+                resultats, indice[k], 
+                restant[k] == 0 
+                    && ( ( automate->finaux[ i / 64 ] >> ( i % 64 ) ) & 1 )
+            );
+            if( suivant < fin ){
+                indice[k] = suivant;
+                lettre[k] = mots[suivant];
+                restant[k] = tailles[suivant];
+                etat[k] = automate->initial;
+                suivant++;
+            }else{
+                lettre[k] = NULL;
+                restant[k] = 0;
+                active[k] = 0;
+                nb_actives--;
+            }
+        }
+    }
+}
+
+/*
+ * Lit les mots d'indices 'debut' à 'fin'-1 sur l'automate figé, un par un,
+ * sur deux tableaux de bits alloués une seule fois.
+ */
+void reconnaitre_lot_fige(
+    const Automate_fige * automate, 
+    const uint8_t * const * mots, const size_t * tailles, 
+    size_t debut, size_t fin, uint64_t * resultats
+){
+    size_t taille = ( automate->nb_mots + 1 ) * sizeof(uint64_t);
+    uint64_t * courants = xmalloc( taille );
+    uint64_t * tampon = xmalloc( taille );
+    size_t i, j;
+    int w;
+    for( i=debut; i<fin; i++ ){
+        memcpy( courants, automate->initiaux, taille );
+        int non_vide = 1;
+        for( j=0; j<tailles[i] && non_vide; j++ ){
+            non_vide = etape_fige( automate, courants, mots[i][j], tampon );
+            uint64_t * tmp = courants;
+            courants = tampon;
+            tampon = tmp;
+        }
+        int reconnu = 0;
+        for( w=0; non_vide && w<automate->nb_mots; w++ ){
+            if( courants[w] & automate->finaux[w] ) reconnu = 1;
+        }
+        ecrire_resultat_lot( resultats, i, reconnu );
+    }
+    xfree( courants );
+    xfree( tampon );
+}
+
+typedef struct {
+    const Automate_lot * automate;
+    const uint8_t * const * mots;
+    const size_t * tailles;
+    size_t debut;
+    size_t fin;
+    uint64_t * resultats;
+} Tranche_lot;
+
+void * reconnaitre_tranche_lot( void * data ){
+    Tranche_lot * t = (Tranche_lot*) data;
+    if( t->automate->dense ){
+        reconnaitre_lot_dense( 
+            t->automate->dense, t->mots, t->tailles, t->debut, t->fin, 
+            t->resultats 
+        );
+    }else{
+        reconnaitre_lot_fige( 
+            t->automate->fige, t->mots, t->tailles, t->debut, t->fin, 
+            t->resultats 
+        );
+    }
+    return NULL;
+}
+
+void reconnaitre_lot_prepare(
+    const Automate_lot * automate, 
+    const uint8_t * const * mots, const size_t * tailles, size_t n,
+    uint64_t * resultats, int nb_fils
+){
+    // Les tranches commencent sur un multiple de 64 : deux fils n'écrivent
+    // jamais dans le même mot de 'resultats'.
+    size_t nb_blocs = ( n + 63 ) / 64;
+    if( nb_fils > (int) nb_blocs ) nb_fils = nb_blocs;
+    if( nb_fils < 1 ) nb_fils = 1;
+
+    Tranche_lot * tranches = xmalloc( nb_fils * sizeof(Tranche_lot) );
+    pthread_t * fils = xmalloc( nb_fils * sizeof(pthread_t) );
+    int f;
+    for( f=0; f<nb_fils; f++ ){
+        Tranche_lot * t = &( tranches[f] );
+        t->automate = automate;
+        t->mots = mots;
+        t->tailles = tailles;
+        t->debut = 64 * ( nb_blocs * f / nb_fils );
+        t->fin = 64 * ( nb_blocs * ( f + 1 ) / nb_fils );
+        if( t->fin > n ) t->fin = n;
+        t->resultats = resultats;
+    }
+    // Le fil appelant lit la première tranche.
+    for( f=1; f<nb_fils; f++ ){
+        if( 
+            pthread_create( 
+                &fils[f], NULL, reconnaitre_tranche_lot, &tranches[f] 
+            ) 
+        ){
+            ERREUR( "Impossible de créer un fil d'exécution" );
+        }
+    }
+    reconnaitre_tranche_lot( &tranches[0] );
+    for( f=1; f<nb_fils; f++ ){
+        pthread_join( fils[f], NULL );
+    }
+    xfree( fils );
+    xfree( tranches );
+}
+
+void reconnaitre_lot(
+    const Automate * automate, 
+    const uint8_t * const * mots, const size_t * tailles, size_t n,
+    uint64_t * resultats, int nb_fils
+){
+    Automate_lot * lot = preparer_automate_lot( automate );
+    reconnaitre_lot_prepare( lot, mots, tailles, n, resultats, nb_fils );
+    liberer_automate_lot( lot );
+}
@@ -0,0 +1,100 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_lot.h */ 
+
+#ifndef __AUTOMATE_LOT_H__
+#define __AUTOMATE_LOT_H__
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "automate_fige.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Un automate préparé pour reconnaître des lots de mots.
+ *
+ * Si l'automate est déterministe, il est compilé en table dense (voir 
+ * compiler_automate()) et les mots d'un lot sont lus plusieurs à la fois, en
+ * entrelaçant leurs lettres : les accès à la table de mots différents sont 
+ * indépendants et leurs temps d'attente se recouvrent. Sinon, il est figé 
+ * (voir figer_automate()) et les mots sont lus sur des tableaux de bits 
+ * alloués une fois par lot.
+ *
+ * Un automate préparé n'est jamais modifié par la lecture : plusieurs fils 
+ * d'exécution peuvent s'en servir en même temps.
+ */
+typedef struct Automate_lot {
+	Automate_dense * dense;   //!< NULL si l'automate n'est pas déterministe
+	Automate_fige * fige;     //!< NULL si l'automate est déterministe
+} Automate_lot;
+
+/**
+ * @brief Prépare un automate pour reconnaitre_lot_prepare().
+ *
+ * L'automate d'origine peut ensuite être modifié ou détruit.
+ *
+ * @param automate Un automate, déterministe ou non.
+ * @return L'automate préparé, à libérer avec liberer_automate_lot().
+ */
+Automate_lot * preparer_automate_lot( const Automate * automate );
+
+/**
+ * @brief Libère la mémoire d'un automate préparé.
+ */
+void liberer_automate_lot( Automate_lot * automate );
+
+/**
+ * @brief Reconnaît un lot de mots.
+ *
+ * Le mot i est formé des tailles[i] octets de mots[i], qui peuvent être 
+ * nuls. Le bit i%64 du mot i/64 de 'resultats' reçoit 1 si le mot i est 
+ * reconnu et 0 sinon ; 'resultats' doit avoir (n+63)/64 mots.
+ *
+ * @param automate Un automate préparé.
+ * @param mots Les adresses des mots.
+ * @param tailles Les nombres d'octets des mots.
+ * @param n Le nombre de mots.
+ * @param resultats Le tableau de bits des résultats.
+ * @param nb_fils Le nombre de fils d'exécution entre lesquels le lot est 
+ *                partagé (1 pour tout lire dans le fil appelant).
+ */
+void reconnaitre_lot_prepare(
+	const Automate_lot * automate, 
+	const uint8_t * const * mots, const size_t * tailles, size_t n,
+	uint64_t * resultats, int nb_fils
+);
+
+/**
+ * @brief Reconnaît un lot de mots sur un automate qui n'a pas été préparé.
+ *
+ * Équivaut à preparer_automate_lot(), reconnaitre_lot_prepare() et 
+ * liberer_automate_lot(). Pour plusieurs lots sur le même automate, il vaut
+ * mieux ne le préparer qu'une fois.
+ */
+void reconnaitre_lot(
+	const Automate * automate, 
+	const uint8_t * const * mots, const size_t * tailles, size_t n,
+	uint64_t * resultats, int nb_fils
+);
+
+#endif
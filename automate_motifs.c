@@ -0,0 +1,315 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_motifs.h"
+#include "automate_fige.h"
+#include "rationnel.h"
+#include "lignes.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    Automate * res;
+    int decalage;
+} data_reunir_t;
+
+void action_reunir_transition( int origine, char lettre, int fin, void* data ){
+    data_reunir_t * d = (data_reunir_t*) data;
+    ajouter_transition( d->res, origine + d->decalage, lettre, fin + d->decalage );
+}
+
+/*
+ * Renvoie l'union disjointe des automates : les états du motif m sont 
+ * renumérotés à partir de la somme des nombres d'états des motifs 
+ * précédents. '*motif_etat' reçoit le motif de chaque état.
+ */
+Automate * reunir_automates_motifs( 
+    const Automate * const * automates, int nb_motifs, int ** motif_etat 
+){
+    Automate * res = creer_automate();
+    data_reunir_t data = { res, 0 };
+    int capacite = 16;
+    *motif_etat = xmalloc( capacite * sizeof(int) );
+    int m;
+    for( m=0; m<nb_motifs; m++ ){
+        Automate * automate = renumeroter_automate( automates[m], 0, NULL );
+        int n = taille_ensemble( get_etats( automate ) );
+        while( data.decalage + n > capacite ){
+            capacite *= 2;
+            *motif_etat = xrealloc( *motif_etat, capacite * sizeof(int) );
+        }
+        int i;
+        for( i=0; i<n; i++ ){
+            ajouter_etat( res, data.decalage + i );
+            (*motif_etat)[ data.decalage + i ] = m;
+            if( est_un_etat_initial_de_l_automate( automate, i ) ){
+                ajouter_etat_initial( res, data.decalage + i );
+            }
+            if( est_un_etat_final_de_l_automate( automate, i ) ){
+                ajouter_etat_final( res, data.decalage + i );
+            }
+        }
+        pour_toute_transition( automate, action_reunir_transition, &data );
+        data.decalage += n;
+        liberer_automate( automate );
+    }
+    return res;
+}
+
+Automate_motifs * compiler_automates_motifs( 
+    const Automate * const * automates, int nb_motifs 
+){
+    int * motif_etat;
+    Automate * reunion = reunir_automates_motifs( 
+        automates, nb_motifs, &motif_etat 
+    );
+    // Les états de la réunion sont 0, 1, ..., n-1 : leurs indices dans 
+    // l'automate figé sont leurs numéros.
+    Automate_fige * fige = figer_automate( reunion );
+    liberer_automate( reunion );
+    int w = fige->nb_mots > 0 ? fige->nb_mots : 1;
+    int nb_mots_motifs = nb_motifs / 64 + 1;
+    int e, l, i, k;
+
+    // Les lettres de l'alphabet
+    int nb_lettres = 0;
+    unsigned char lettres[256];
+    int presente[256];
+    memset( presente, 0, sizeof(presente) );
+    for( i=0; i<fige->nb_groupes; i++ ){
+        if( ! presente[ fige->lettres[i] ] ){
+            presente[ fige->lettres[i] ] = 1;
+            lettres[ nb_lettres++ ] = fige->lettres[i];
+        }
+    }
+
+    // Déterminisation. L'ensemble vide reçoit le numéro 0.
+    Lignes ensembles;
+    initialiser_lignes( &ensembles, w );
+    uint64_t * courant = xmalloc( 2 * w * sizeof(uint64_t) );
+    uint64_t * suivant = courant + w;
+    memset( courant, 0, w * sizeof(uint64_t) );
+    interner_ligne( &ensembles, courant );
+    memcpy( courant, fige->initiaux, fige->nb_mots * sizeof(uint64_t) );
+    int initial = interner_ligne( &ensembles, courant );
+
+    int capacite = 16;
+    int * delta = xmalloc( (size_t) capacite * ( nb_lettres + 1 ) * sizeof(int) );
+    memset( suivant, 0, w * sizeof(uint64_t) );
+    for( e=0; e<ensembles.nb; e++ ){
+        if( e == capacite ){
+            capacite *= 2;
+            delta = xrealloc( 
+                delta, (size_t) capacite * ( nb_lettres + 1 ) * sizeof(int) 
+            );
+        }
+        memcpy( courant, lire_ligne( &ensembles, e ), w * sizeof(uint64_t) );
+        for( l=0; l<nb_lettres; l++ ){
+            etape_fige( fige, courant, lettres[l], suivant );
+            delta[ (size_t) e * nb_lettres + l ] = 
+                interner_ligne( &ensembles, suivant );
+        }
+    }
+    int nb_ensembles = ensembles.nb;
+
+    // Les motifs de chaque état
+    uint64_t * motifs = xmalloc( 
+        (size_t) nb_ensembles * nb_mots_motifs * sizeof(uint64_t) 
+    );
+    memset( motifs, 0, (size_t) nb_ensembles * nb_mots_motifs * sizeof(uint64_t) );
+    for( e=0; e<nb_ensembles; e++ ){
+        const uint64_t * ensemble = lire_ligne( &ensembles, e );
+        for( k=0; k<fige->nb_mots; k++ ){
+            uint64_t finaux = ensemble[k] & fige->finaux[k];
+            while( finaux ){
+                int m = motif_etat[ k * 64 + __builtin_ctzll( finaux ) ];
+                finaux &= finaux - 1;
+                motifs[ (size_t) e * nb_mots_motifs + m / 64 ] |= 
+                    (uint64_t) 1 << ( m % 64 );
+            }
+        }
+    }
+    liberer_lignes( &ensembles );
+    liberer_automate_fige( fige );
+    xfree( motif_etat );
+
+    // Minimisation par raffinements successifs (algorithme de Moore) : on 
+    // part des classes d'états qui portent les mêmes motifs, puis on sépare
+    // les états dont une lettre mène à des classes différentes, jusqu'à ce 
+    // que le nombre de classes ne change plus. L'ensemble vide est toujours
+    // dans la classe 0.
+    int * classe = xmalloc( nb_ensembles * sizeof(int) );
+    Lignes classes;
+    initialiser_lignes( &classes, nb_mots_motifs );
+    for( e=0; e<nb_ensembles; e++ ){
+        classe[e] = interner_ligne( 
+            &classes, motifs + (size_t) e * nb_mots_motifs 
+        );
+    }
+    int nb_classes_etats = classes.nb;
+    liberer_lignes( &classes );
+
+    uint64_t * signature = xmalloc( ( nb_lettres + 1 ) * sizeof(uint64_t) );
+    int * nouvelle_classe = xmalloc( nb_ensembles * sizeof(int) );
+    for( ;; ){
+        initialiser_lignes( &classes, nb_lettres + 1 );
+        for( e=0; e<nb_ensembles; e++ ){
+            signature[0] = classe[e];
+            for( l=0; l<nb_lettres; l++ ){
+                signature[l+1] = classe[ delta[ (size_t) e * nb_lettres + l ] ];
+            }
+            nouvelle_classe[e] = interner_ligne( &classes, signature );
+        }
+        int nb = classes.nb;
+        liberer_lignes( &classes );
+        int * tmp = classe;
+        classe = nouvelle_classe;
+        nouvelle_classe = tmp;
+        if( nb == nb_classes_etats ) break;
+        nb_classes_etats = nb;
+    }
+    xfree( signature );
+    xfree( nouvelle_classe );
+
+    // Un représentant de chaque classe d'états
+    int * representant = xmalloc( nb_classes_etats * sizeof(int) );
+    for( e=nb_ensembles-1; e>=0; e-- ){
+        representant[ classe[e] ] = e;
+    }
+
+    Automate_motifs * res = xmalloc( sizeof(Automate_motifs) );
+    res->nb_motifs = nb_motifs;
+    res->nb_mots_motifs = nb_mots_motifs;
+    res->nb_etats = nb_classes_etats;
+
+    // Les octets qui ont la même colonne partagent une classe d'octets. La 
+    // classe 0 est celle de la colonne qui ne mène qu'au puits.
+    int * colonnes = xmalloc( 
+        (size_t) ( nb_lettres + 1 ) * nb_classes_etats * sizeof(int) 
+    );
+    memset( colonnes, 0, (size_t) nb_classes_etats * sizeof(int) );
+    int nb_colonnes = 1;
+    int * colonne = colonnes + (size_t) nb_colonnes * nb_classes_etats;
+    memset( res->classes, 0, sizeof(res->classes) );
+    for( l=0; l<nb_lettres; l++ ){
+        for( i=0; i<nb_classes_etats; i++ ){
+            colonne[i] = 
+                classe[ delta[ (size_t) representant[i] * nb_lettres + l ] ];
+        }
+        int c;
+        for( c=0; c<nb_colonnes; c++ ){
+            if( 
+                ! memcmp( 
+                    colonne, colonnes + (size_t) c * nb_classes_etats,
+                    nb_classes_etats * sizeof(int)
+                )
+            ){
+                break;
+            }
+        }
+        if( c == nb_colonnes ){
+            nb_colonnes++;
+            colonne += nb_classes_etats;
+        }
+        res->classes[ lettres[l] ] = c;
+    }
+    res->nb_classes = nb_colonnes;
+
+    // La table, en décalages
+    res->transitions = xmalloc( 
+        (size_t) nb_classes_etats * nb_colonnes * sizeof(int) 
+    );
+    for( i=0; i<nb_classes_etats; i++ ){
+        int c;
+        for( c=0; c<nb_colonnes; c++ ){
+            res->transitions[ (size_t) i * nb_colonnes + c ] = 
+                colonnes[ (size_t) c * nb_classes_etats + i ] * nb_colonnes;
+        }
+    }
+    res->initial = classe[initial] * nb_colonnes;
+
+    res->motifs = xmalloc( 
+        (size_t) nb_classes_etats * nb_mots_motifs * sizeof(uint64_t) 
+    );
+    for( i=0; i<nb_classes_etats; i++ ){
+        memcpy( 
+            res->motifs + (size_t) i * nb_mots_motifs, 
+            motifs + (size_t) representant[i] * nb_mots_motifs,
+            nb_mots_motifs * sizeof(uint64_t)
+        );
+    }
+
+    xfree( colonnes );
+    xfree( representant );
+    xfree( classe );
+    xfree( motifs );
+    xfree( delta );
+    xfree( courant );
+    return res;
+}
+
+Automate_motifs * compiler_expressions_motifs( 
+    const char * const * expressions, int nb_motifs 
+){
+    Automate ** automates = xmalloc( ( nb_motifs + 1 ) * sizeof(Automate*) );
+    int m, nb = 0;
+    for( m=0; m<nb_motifs; m++ ){
+        Rationnel * rat = expression_to_rationnel( expressions[m] );
+        if( ! rat ) break;
+        automates[ nb++ ] = Glushkov( rat );
+    }
+    Automate_motifs * res = NULL;
+    if( nb == nb_motifs ){
+        res = compiler_automates_motifs( 
+            (const Automate * const *) automates, nb_motifs 
+        );
+    }
+    for( m=0; m<nb; m++ ){
+        liberer_automate( automates[m] );
+    }
+    xfree( automates );
+    return res;
+}
+
+void liberer_automate_motifs( Automate_motifs * automate ){
+    xfree( automate->transitions );
+    xfree( automate->motifs );
+    xfree( automate );
+}
+
+const uint64_t * reconnaitre_motifs( 
+    const Automate_motifs * automate, const uint8_t * mot, size_t taille 
+){
+    const int * transitions = automate->transitions;
+    const uint16_t * classes = automate->classes;
+    const uint8_t * fin = mot + taille;
+    int etat = automate->initial;
+    while( mot < fin && etat ){
+        etat = transitions[ etat + classes[ *mot++ ] ];
+    }
+    return automate->motifs 
+        + (size_t) ( etat / automate->nb_classes ) * automate->nb_mots_motifs;
+}
+
+int est_un_motif_reconnu( const uint64_t * motifs, int motif ){
+    return ( motifs[ motif / 64 ] >> ( motif % 64 ) ) & 1;
+}
@@ -0,0 +1,120 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_motifs.h */ 
+
+#ifndef __AUTOMATE_MOTIFS_H__
+#define __AUTOMATE_MOTIFS_H__
+
+#include "automate.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Un automate qui reconnaît plusieurs langages (les « motifs ») à la 
+ *        fois.
+ *
+ * On réunit les automates des motifs, numérotés de 0 à nb_motifs-1, en un 
+ * seul automate non déterministe dont les états sont disjoints et dont les
+ * états initiaux sont ceux de tous les motifs. Chaque état final porte le 
+ * numéro de son motif. On le déterminise ensuite : chaque état de 
+ * l'automate déterministe porte l'ensemble des motifs de ses états finaux.
+ * On le minimise enfin en ne confondant que des états qui portent les mêmes
+ * motifs.
+ *
+ * Un mot est donc lu une seule fois, quel que soit le nombre de motifs, et
+ * l'état atteint donne directement l'ensemble des motifs qui le 
+ * reconnaissent.
+ *
+ * La table des transitions suit la même organisation que celle d'un 
+ * Automate_dense : les états sont des décalages dans 'transitions', les 
+ * octets sont regroupés en classes, et le puits (l'état d'indice 0, depuis
+ * lequel aucun motif n'est plus accessible) est au décalage 0. La classe 0
+ * est celle des octets qui ne sont dans l'alphabet d'aucun motif.
+ *
+ * Les ensembles de motifs sont des tableaux de bits de nb_mots_motifs mots :
+ * le motif m est dans l'ensemble si le bit m%64 du mot m/64 vaut 1.
+ */
+typedef struct Automate_motifs {
+	int nb_motifs;
+	int nb_mots_motifs;
+	int nb_etats;
+	int nb_classes;
+	uint16_t classes[256];     //!< Jusqu'à 257 classes, puits compris
+	int * transitions;         //!< nb_etats * nb_classes décalages
+	int initial;               //!< Décalage de l'état initial
+	uint64_t * motifs;         //!< Les motifs de chaque état, par indice
+} Automate_motifs;
+
+/**
+ * @brief Compile un ensemble d'automates en un seul automate à motifs.
+ *
+ * Les automates peuvent être non déterministes ; ils peuvent ensuite être 
+ * modifiés ou détruits.
+ *
+ * @param automates Les automates des motifs : le motif m est automates[m].
+ * @param nb_motifs Le nombre de motifs.
+ * @return L'automate à motifs, à libérer avec liberer_automate_motifs().
+ */
+Automate_motifs * compiler_automates_motifs( 
+	const Automate * const * automates, int nb_motifs 
+);
+
+/**
+ * @brief Compile un ensemble d'expressions rationnelles, par leurs 
+ *        automates de Glushkov, en un seul automate à motifs.
+ *
+ * @param expressions Les expressions, dans la syntaxe de 
+ *        expression_to_rationnel() : le motif m est expressions[m].
+ * @param nb_motifs Le nombre d'expressions.
+ * @return L'automate à motifs, ou NULL si une des expressions est invalide.
+ */
+Automate_motifs * compiler_expressions_motifs( 
+	const char * const * expressions, int nb_motifs 
+);
+
+/**
+ * @brief Libère la mémoire d'un automate à motifs.
+ */
+void liberer_automate_motifs( Automate_motifs * automate );
+
+/**
+ * @brief Renvoie l'ensemble des motifs qui reconnaissent un mot.
+ *
+ * La lecture s'arrête dès que l'automate atteint le puits.
+ *
+ * @param automate Un automate à motifs.
+ * @param mot Les octets du mot, qui peut contenir des octets nuls.
+ * @param taille Le nombre d'octets du mot.
+ * @return Un tableau de bits de nb_mots_motifs mots, qui appartient à 
+ *         l'automate : il ne faut ni le modifier ni le libérer.
+ */
+const uint64_t * reconnaitre_motifs( 
+	const Automate_motifs * automate, const uint8_t * mot, size_t taille 
+);
+
+/**
+ * @brief Renvoie 1 si le motif 'motif' est dans l'ensemble de motifs 
+ *        'motifs' renvoyé par reconnaitre_motifs(), et 0 sinon.
+ */
+int est_un_motif_reconnu( const uint64_t * motifs, int motif );
+
+#endif
@@ -0,0 +1,189 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_parallele.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Taille minimale d'une tranche lue par un fil d'exécution.
+ */
+#define TAILLE_MIN_TRANCHE ( 1 << 16 )
+
+/*
+ * Nombre d'octets lus entre deux fusions des lectures arrivées dans le même
+ * état.
+ */
+#define OCTETS_ENTRE_FUSIONS 64
+
+typedef struct {
+    const Automate_dense * automate;
+    const uint8_t * debut;
+    const uint8_t * fin;
+    int * transfert;     //!< État atteint depuis chaque indice d'état
+} Tranche_parallele;
+
+/*
+ * Lit les octets de [debut, fin) depuis l'état 'etat' et renvoie l'état 
+ * atteint.
+ */
+int lire_tranche_dense( 
+    const Automate_dense * automate, int etat, 
+    const uint8_t * debut, const uint8_t * fin 
+){
+    const int * transitions = automate->transitions;
+    const uint16_t * classes = automate->classes;
+    while( debut < fin && etat ){
+        etat = transitions[ etat + classes[ *debut++ ] ];
+    }
+    return etat;
+}
+
+/*
+ * Calcule la fonction de transfert d'une tranche. 'actifs' contient les 
+ * états distincts des lectures en cours, et 'origine' donne, pour chaque 
+ * indice d'état de départ, la lecture qui en est partie.
+ */
+void * calculer_transfert_tranche( void * data ){
+    Tranche_parallele * t = (Tranche_parallele*) data;
+    const Automate_dense * automate = t->automate;
+    const int * transitions = automate->transitions;
+    const uint16_t * classes = automate->classes;
+    int n = automate->nb_etats;
+    int * actifs = xmalloc( n * sizeof(int) );
+    int * origine = xmalloc( n * sizeof(int) );
+    int * renvoi = xmalloc( n * sizeof(int) );
+    int * lecture_de_l_etat = xmalloc( n * sizeof(int) );
+    int i, j;
+    for( i=0; i<n; i++ ){
+        actifs[i] = i * automate->nb_classes;
+        origine[i] = i;
+        lecture_de_l_etat[i] = -1;
+    }
+    int nb_actifs = n;
+
+    const uint8_t * lettre = t->debut;
+    while( lettre < t->fin && nb_actifs > 1 ){
+        const uint8_t * fin_bloc = lettre + OCTETS_ENTRE_FUSIONS;
+        if( fin_bloc > t->fin ) fin_bloc = t->fin;
+        for( ; lettre < fin_bloc; lettre++ ){
+            int c = classes[ *lettre ];
+            for( j=0; j<nb_actifs; j++ ){
+                actifs[j] = transitions[ actifs[j] + c ];
+            }
+        }
+
+        // Fusion des lectures arrivées dans le même état
+        int nb = 0;
+        for( j=0; j<nb_actifs; j++ ){
+            int indice = actifs[j] / automate->nb_classes;
+            if( lecture_de_l_etat[indice] < 0 ){
+                lecture_de_l_etat[indice] = nb;
+                actifs[nb++] = actifs[j];
+            }
+            renvoi[j] = lecture_de_l_etat[indice];
+        }
+        for( j=0; j<nb; j++ ){
+            lecture_de_l_etat[ actifs[j] / automate->nb_classes ] = -1;
+        }
+        if( nb < nb_actifs ){
+            for( i=0; i<n; i++ ){
+                origine[i] = renvoi[ origine[i] ];
+            }
+            nb_actifs = nb;
+        }
+    }
+    if( nb_actifs == 1 ){
+        actifs[0] = lire_tranche_dense( automate, actifs[0], lettre, t->fin );
+    }
+    for( i=0; i<n; i++ ){
+        t->transfert[i] = actifs[ origine[i] ];
+    }
+    xfree( actifs );
+    xfree( origine );
+    xfree( renvoi );
+    xfree( lecture_de_l_etat );
+    return NULL;
+}
+
+void lire_morceau_dense_parallele( 
+    Lecture_dense * lecture, const char * morceau, size_t taille, int nb_fils
+){
+    const Automate_dense * automate = lecture->automate;
+    const uint8_t * debut = (const uint8_t*) morceau;
+    if( (size_t) nb_fils > taille / TAILLE_MIN_TRANCHE ){
+        nb_fils = taille / TAILLE_MIN_TRANCHE;
+    }
+    if( nb_fils <= 1 || ! lecture->etat ){
+        lecture->etat = lire_tranche_dense( 
+            automate, lecture->etat, debut, debut + taille 
+        );
+        return;
+    }
+
+    Tranche_parallele * tranches = xmalloc( nb_fils * sizeof(Tranche_parallele) );
+    pthread_t * fils = xmalloc( nb_fils * sizeof(pthread_t) );
+    int * transferts = xmalloc( 
+        (size_t) nb_fils * automate->nb_etats * sizeof(int) 
+    );
+    int f;
+    for( f=0; f<nb_fils; f++ ){
+        Tranche_parallele * t = &( tranches[f] );
+        t->automate = automate;
+        t->debut = debut + taille * f / nb_fils;
+        t->fin = debut + taille * ( f + 1 ) / nb_fils;
+        t->transfert = transferts + (size_t) f * automate->nb_etats;
+    }
+    for( f=1; f<nb_fils; f++ ){
+        if( 
+            pthread_create( 
+                &fils[f], NULL, calculer_transfert_tranche, &tranches[f] 
+            ) 
+        ){
+            ERREUR( "Impossible de créer un fil d'exécution" );
+        }
+    }
+    // Le fil appelant lit la première tranche depuis l'état connu.
+    int etat = lire_tranche_dense( 
+        automate, lecture->etat, tranches[0].debut, tranches[0].fin 
+    );
+    for( f=1; f<nb_fils; f++ ){
+        pthread_join( fils[f], NULL );
+        etat = tranches[f].transfert[ etat / automate->nb_classes ];
+    }
+    lecture->etat = etat;
+
+    xfree( transferts );
+    xfree( fils );
+    xfree( tranches );
+}
+
+int le_mot_est_reconnu_dense_parallele( 
+    const Automate_dense * automate, const uint8_t * mot, size_t taille, 
+    int nb_fils
+){
+    Lecture_dense lecture;
+    commencer_lecture_dense( &lecture, automate );
+    lire_morceau_dense_parallele( &lecture, (const char*) mot, taille, nb_fils );
+    return terminer_lecture_dense( &lecture );
+}
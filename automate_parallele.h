@@ -0,0 +1,67 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_parallele.h */ 
+
+#ifndef __AUTOMATE_PARALLELE_H__
+#define __AUTOMATE_PARALLELE_H__
+
+#include "automate_dense.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Lit un long morceau sur plusieurs fils d'exécution.
+ *
+ * Le morceau est coupé en 'nb_fils' tranches. La première est lue depuis 
+ * l'état courant de la lecture. Pour chacune des suivantes, dont l'état de 
+ * départ n'est pas encore connu, un fil calcule la fonction de transfert de
+ * la tranche : l'état atteint depuis chaque état de l'automate. Il lit pour
+ * cela la tranche depuis tous les états à la fois, et confond régulièrement 
+ * les lectures arrivées dans le même état ; dans la plupart des automates 
+ * elles se rejoignent vite, et le fil finit la tranche sur une seule 
+ * lecture. Les fonctions de transfert sont enfin composées dans l'ordre des
+ * tranches.
+ *
+ * Le résultat est exactement celui de lire_morceau_dense(). Quand les 
+ * tranches seraient trop courtes pour que le calcul en vaille la peine, 
+ * le morceau est lu par le fil appelant seul.
+ *
+ * @param lecture Une lecture commencée par commencer_lecture_dense().
+ * @param morceau Les octets à lire, qui peuvent être nuls.
+ * @param taille Le nombre d'octets.
+ * @param nb_fils Le nombre de fils d'exécution, y compris le fil appelant.
+ */
+void lire_morceau_dense_parallele( 
+	Lecture_dense * lecture, const char * morceau, size_t taille, int nb_fils
+);
+
+/**
+ * @brief Renvoie 1 si le mot de 'taille' octets est reconnu par l'automate 
+ *        dense, 0 sinon, en le lisant sur 'nb_fils' fils d'exécution (voir
+ *        lire_morceau_dense_parallele()).
+ */
+int le_mot_est_reconnu_dense_parallele( 
+	const Automate_dense * automate, const uint8_t * mot, size_t taille, 
+	int nb_fils
+);
+
+#endif
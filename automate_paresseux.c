@@ -0,0 +1,247 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_paresseux.h"
+#include "table.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Nombre minimal de lettres lues par état créé : en dessous, le cache est 
+ * vidé trop souvent et la fin du mot est lue sur l'automate non 
+ * déterministe.
+ */
+#define LETTRES_PAR_ETAT_MIN 8
+
+Automate_paresseux * creer_automate_paresseux( 
+    const Automate * automate, size_t memoire_max 
+){
+    Automate_paresseux * res = xmalloc( sizeof(Automate_paresseux) );
+    res->fige = figer_automate( automate );
+    res->nb_mots = res->fige->nb_mots > 0 ? res->fige->nb_mots : 1;
+
+    size_t taille_etat = 
+        256 * sizeof(int) + res->nb_mots * sizeof(uint64_t) + 1 
+        + 2 * sizeof(int);
+    size_t nb_max = memoire_max / taille_etat;
+    if( nb_max < 2 ) nb_max = 2;
+    if( nb_max > ( 1 << 24 ) ) nb_max = 1 << 24;
+    res->nb_max_etats = nb_max;
+
+    res->masque_alveoles = 1;
+    while( res->masque_alveoles < 2 * res->nb_max_etats ){
+        res->masque_alveoles *= 2;
+    }
+    res->alveoles = xmalloc( res->masque_alveoles * sizeof(int) );
+    res->masque_alveoles -= 1;
+
+    res->ensembles = xmalloc( 
+        (size_t) res->nb_max_etats * res->nb_mots * sizeof(uint64_t) 
+    );
+    res->transitions = xmalloc( 
+        (size_t) res->nb_max_etats * 256 * sizeof(int) 
+    );
+    res->finaux = xmalloc( res->nb_max_etats );
+    res->tampon = xmalloc( res->nb_mots * sizeof(uint64_t) );
+    memset( res->tampon, 0, res->nb_mots * sizeof(uint64_t) );
+
+    res->nb_vidages = 0;
+    res->nb_etats = 0;
+    res->initial = -1;
+    res->mort = -1;
+    memset( res->alveoles, -1, ( res->masque_alveoles + 1 ) * sizeof(int) );
+    return res;
+}
+
+void liberer_automate_paresseux( Automate_paresseux * automate ){
+    liberer_automate_fige( automate->fige );
+    xfree( automate->ensembles );
+    xfree( automate->transitions );
+    xfree( automate->finaux );
+    xfree( automate->alveoles );
+    xfree( automate->tampon );
+    xfree( automate );
+}
+
+/*
+ * Oublie tous les états du cache.
+ */
+void vider_cache_paresseux( Automate_paresseux * automate ){
+    automate->nb_etats = 0;
+    automate->initial = -1;
+    automate->mort = -1;
+    automate->nb_vidages++;
+    memset( 
+        automate->alveoles, -1, 
+        ( automate->masque_alveoles + 1 ) * sizeof(int) 
+    );
+}
+
+uint64_t hacher_ensemble_paresseux( const uint64_t * ensemble, int nb_mots ){
+    uint64_t h = 0;
+    int w;
+    for( w=0; w<nb_mots; w++ ){
+        h = hacher_entier( h ^ ensemble[w] );
+    }
+    return h;
+}
+
+/*
+ * Renvoie l'état dont l'ensemble est 'ensemble', en le créant s'il n'est pas
+ * dans le cache. Renvoie -1 si le cache est plein.
+ */
+int trouver_etat_paresseux( 
+    Automate_paresseux * automate, const uint64_t * ensemble 
+){
+    int w = automate->nb_mots;
+    size_t taille = w * sizeof(uint64_t);
+    int a = 
+        hacher_ensemble_paresseux( ensemble, w ) & automate->masque_alveoles;
+    while( automate->alveoles[a] >= 0 ){
+        int etat = automate->alveoles[a];
+        if( ! memcmp( automate->ensembles + (size_t) etat * w, ensemble, taille ) ){
+            return etat;
+        }
+        a = ( a + 1 ) & automate->masque_alveoles;
+    }
+    if( automate->nb_etats == automate->nb_max_etats ) return -1;
+
+    int etat = automate->nb_etats++;
+    automate->alveoles[a] = etat;
+    memcpy( automate->ensembles + (size_t) etat * w, ensemble, taille );
+    memset( 
+        automate->transitions + (size_t) etat * 256, -1, 256 * sizeof(int) 
+    );
+    uint64_t final = 0, non_vide = 0;
+    int k;
+    for( k=0; k<w; k++ ){
+        final |= ensemble[k] & automate->fige->finaux[k];
+        non_vide |= ensemble[k];
+    }
+    automate->finaux[etat] = ( final != 0 );
+    if( ! non_vide ) automate->mort = etat;
+    return etat;
+}
+
+/*
+ * Renvoie l'état de 'ensemble', en vidant le cache s'il est plein.
+ */
+int ajouter_etat_paresseux( 
+    Automate_paresseux * automate, const uint64_t * ensemble 
+){
+    int etat = trouver_etat_paresseux( automate, ensemble );
+    if( etat < 0 ){
+        vider_cache_paresseux( automate );
+        etat = trouver_etat_paresseux( automate, ensemble );
+    }
+    return etat;
+}
+
+/*
+ * Lit la fin du mot sur l'automate non déterministe, à partir de l'ensemble
+ * de l'état 'etat'.
+ */
+int lire_fin_du_mot_paresseux( 
+    Automate_paresseux * automate, int etat, 
+    const uint8_t * lettre, const uint8_t * fin
+){
+    int w = automate->nb_mots;
+    uint64_t * memoire = xmalloc( 2 * w * sizeof(uint64_t) );
+    uint64_t * courants = memoire;
+    uint64_t * tampon = memoire + w;
+    memcpy( 
+        courants, automate->ensembles + (size_t) etat * w, 
+        w * sizeof(uint64_t) 
+    );
+    memset( tampon, 0, w * sizeof(uint64_t) );
+    for( ; lettre < fin; lettre++ ){
+        if( ! etape_fige( automate->fige, courants, *lettre, tampon ) ) break;
+        uint64_t * tmp = courants;
+        courants = tampon;
+        tampon = tmp;
+    }
+    int result = 0;
+    if( lettre == fin ){
+        int k;
+        for( k=0; k<w; k++ ){
+            if( courants[k] & automate->fige->finaux[k] ) result = 1;
+        }
+    }
+    xfree( memoire );
+    return result;
+}
+
+int le_mot_est_reconnu_paresseux( 
+    Automate_paresseux * automate, const char * mot 
+){
+    return le_mot_est_reconnu_paresseux_octets( 
+        automate, (const uint8_t*) mot, strlen( mot ) 
+    );
+}
+
+int le_mot_est_reconnu_paresseux_octets( 
+    Automate_paresseux * automate, const uint8_t * mot, size_t taille 
+){
+    if( automate->initial < 0 ){
+        automate->initial = 
+            ajouter_etat_paresseux( automate, automate->fige->initiaux );
+    }
+    int etat = automate->initial;
+    const uint8_t * lettre = mot;
+    const uint8_t * fin = mot + taille;
+    const uint8_t * dernier_vidage = lettre;
+    size_t nb_vidages = automate->nb_vidages;
+    while( lettre < fin ){
+        if( etat == automate->mort ) return 0;
+        int suivant = automate->transitions[ (size_t) etat * 256 + *lettre ];
+        if( suivant < 0 ){
+            int w = automate->nb_mots;
+            etape_fige( 
+                automate->fige, automate->ensembles + (size_t) etat * w, 
+                *lettre, automate->tampon 
+            );
+            suivant = trouver_etat_paresseux( automate, automate->tampon );
+            if( suivant >= 0 ){
+                automate->transitions[ (size_t) etat * 256 + *lettre ] = suivant;
+            }else{
+                // Le cache est plein. S'il a déjà été vidé pendant la 
+                // lecture de ce mot et rempli trop vite depuis, on termine 
+                // sur l'automate non déterministe.
+                if( 
+                    automate->nb_vidages != nb_vidages
+                    && lettre - dernier_vidage 
+                    < (ptrdiff_t) LETTRES_PAR_ETAT_MIN * automate->nb_max_etats
+                ){
+                    return lire_fin_du_mot_paresseux( 
+                        automate, etat, lettre, fin 
+                    );
+                }
+                vider_cache_paresseux( automate );
+                dernier_vidage = lettre;
+                suivant = trouver_etat_paresseux( automate, automate->tampon );
+            }
+        }
+        etat = suivant;
+        lettre++;
+    }
+    return automate->finaux[etat];
+}
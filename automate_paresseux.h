@@ -0,0 +1,109 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_paresseux.h */ 
+
+#ifndef __AUTOMATE_PARESSEUX_H__
+#define __AUTOMATE_PARESSEUX_H__
+
+#include "automate.h"
+#include "automate_fige.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Le type d'un automate déterminisé à la demande.
+ *
+ * Les états de l'automate déterministe (des ensembles d'états de l'automate
+ * d'origine) ne sont calculés qu'au moment où la lecture d'un mot les 
+ * atteint, puis gardés dans un cache avec leurs transitions déjà calculées. 
+ * Sur la partie de l'entrée qui ne rencontre que des états connus, la 
+ * lecture d'une lettre coûte un accès à un tableau, comme pour un automate 
+ * déterministe, sans jamais construire tout l'automate des parties.
+ *
+ * Le cache contient au plus nb_max_etats états. Quand il est plein, il est
+ * vidé et la lecture continue. Si, pendant la lecture d'un mot, le cache se 
+ * remplit à nouveau peu après avoir été vidé (moins de 8 lettres lues par 
+ * état créé), la fin du mot est lue directement sur l'automate non 
+ * déterministe.
+ *
+ * L'état d'identifiant i a pour ensemble le tableau de bits de nb_mots mots
+ * commençant à ensembles[ i * nb_mots ] (indices de l'automate figé), et son
+ * successeur par l'octet c est transitions[ i * 256 + c ], ou -1 s'il n'est 
+ * pas encore calculé.
+ *
+ * Un automate paresseux est modifié par la lecture : il ne doit pas être 
+ * utilisé par deux fils d'exécution en même temps.
+ */
+typedef struct Automate_paresseux {
+	Automate_fige * fige;
+	int nb_mots;
+	int nb_max_etats;
+	int nb_etats;
+	uint64_t * ensembles;
+	int * transitions;
+	unsigned char * finaux;   //!< 1 si l'état est final
+	int * alveoles;           //!< Table de hachage des ensembles : -1 ou un état
+	int masque_alveoles;
+	int initial;              //!< État initial, ou -1 s'il n'est pas dans le cache
+	int mort;                 //!< État de l'ensemble vide, ou -1
+	uint64_t * tampon;
+	size_t nb_vidages;        //!< Nombre de fois où le cache a été vidé
+} Automate_paresseux;
+
+/**
+ * @brief Crée un automate déterminisé à la demande.
+ *
+ * L'automate d'origine peut ensuite être modifié ou détruit.
+ *
+ * @param automate Un automate, déterministe ou non.
+ * @param memoire_max Le nombre d'octets que peut occuper le cache des états
+ *                    (au moins deux états sont toujours gardés).
+ * @return L'automate, à libérer avec liberer_automate_paresseux().
+ */
+Automate_paresseux * creer_automate_paresseux( 
+	const Automate * automate, size_t memoire_max 
+);
+
+/**
+ * @brief Libère la mémoire d'un automate déterminisé à la demande.
+ */
+void liberer_automate_paresseux( Automate_paresseux * automate );
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un automate déterminisé à
+ *        la demande.
+ *
+ * Les états calculés restent dans le cache pour les mots suivants.
+ */
+int le_mot_est_reconnu_paresseux( 
+	Automate_paresseux * automate, const char * mot 
+);
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu_paresseux() pour un mot de 
+ *        'taille' octets, qui peut contenir des octets nuls.
+ */
+int le_mot_est_reconnu_paresseux_octets( 
+	Automate_paresseux * automate, const uint8_t * mot, size_t taille 
+);
+
+#endif
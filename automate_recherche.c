@@ -0,0 +1,201 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+
+#include "automate_recherche.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Renvoie une copie de l'automate où chaque état initial boucle sur toutes 
+ * les lettres de l'alphabet : il reconnaît A*L, pour les mots qui ne 
+ * contiennent que des lettres de l'alphabet.
+ */
+Automate * creer_automate_facteurs( const Automate * automate ){
+    Automate * res = copier_automate( automate );
+    Ensemble_iterateur it_initial, it_lettre;
+    for(
+            it_initial = premier_iterateur_ensemble( get_initiaux( automate ) );
+            ! iterateur_ensemble_est_vide( it_initial );
+            it_initial = iterateur_suivant_ensemble( it_initial )
+       ){
+        int initial = get_element( it_initial );
+        for(
+                it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
+                ! iterateur_ensemble_est_vide( it_lettre );
+                it_lettre = iterateur_suivant_ensemble( it_lettre )
+           ){
+            ajouter_transition( res, initial, get_element( it_lettre ), initial );
+        }
+    }
+    return res;
+}
+
+typedef struct {
+    const Automate * automate;
+    Automate_recherche * recherche;
+} data_premieres_t;
+
+void action_premiere_lettre( int origine, char lettre, int fin, void* data ){
+    data_premieres_t * d = (data_premieres_t*) data;
+    unsigned char c = lettre;
+    if( 
+        est_un_etat_initial_de_l_automate( d->automate, origine ) 
+        && ! d->recherche->premieres[c] 
+    ){
+        d->recherche->premieres[c] = 1;
+        d->recherche->premiere = c;
+        d->recherche->nb_premieres++;
+    }
+}
+
+Automate_recherche * compiler_automate_recherche( const Automate * automate ){
+    Automate_recherche * res = xmalloc( sizeof(Automate_recherche) );
+
+    Automate * facteurs = creer_automate_facteurs( automate );
+    Automate * deterministe = creer_automate_deterministe( facteurs );
+    res->dense = compiler_automate( deterministe );
+    liberer_automate( deterministe );
+    liberer_automate( facteurs );
+
+    // Un octet qui n'est pas dans l'alphabet ne mène pas à l'état puits mais
+    // recommence la recherche.
+    Automate_dense * dense = res->dense;
+    int i;
+    for( i=0; i<dense->nb_etats; i++ ){
+        dense->transitions[ i * dense->nb_classes ] = dense->initial;
+    }
+
+    res->finaux = xmalloc( dense->nb_etats * dense->nb_classes );
+    memset( res->finaux, 0, dense->nb_etats * dense->nb_classes );
+    for( i=0; i<dense->nb_etats; i++ ){
+        res->finaux[ i * dense->nb_classes ] = 
+            ( dense->finaux[ i / 64 ] >> ( i % 64 ) ) & 1;
+    }
+
+    memset( res->premieres, 0, sizeof(res->premieres) );
+    res->nb_premieres = 0;
+    res->premiere = 0;
+    data_premieres_t data = { automate, res };
+    pour_toute_transition( automate, action_premiere_lettre, &data );
+
+    res->facteur = NULL;
+    res->taille_facteur = 0;
+    return res;
+}
+
+Automate_recherche * compiler_rationnel_recherche( Rationnel * rat ){
+    Automate * glushkov = Glushkov( rat );
+    Automate_recherche * res = compiler_automate_recherche( glushkov );
+    liberer_automate( glushkov );
+
+    size_t taille;
+    char * facteur = facteur_obligatoire( rat, &taille );
+    if( taille >= 2 ){
+        res->facteur = facteur;
+        res->taille_facteur = taille;
+    }else{
+        xfree( facteur );
+    }
+    return res;
+}
+
+void liberer_automate_recherche( Automate_recherche * automate ){
+    liberer_automate_dense( automate->dense );
+    if( automate->facteur ) xfree( automate->facteur );
+    xfree( automate->finaux );
+    xfree( automate );
+}
+
+/*
+ * Renvoie l'adresse du premier octet de [debut, fin) qui peut commencer une
+ * occurrence, ou 'fin' s'il n'y en a pas.
+ */
+const uint8_t * sauter_octets_recherche(
+    const Automate_recherche * automate, 
+    const uint8_t * debut, const uint8_t * fin 
+){
+    if( automate->nb_premieres == 1 ){
+        const uint8_t * p = memchr( debut, automate->premiere, fin - debut );
+        return p ? p : fin;
+    }
+    while( debut < fin && ! automate->premieres[ *debut ] ) debut++;
+    return debut;
+}
+
+/*
+ * Appelée dans l'état initial en 'debut' : saute jusqu'à la prochaine 
+ * apparition du facteur obligatoire, puis revient juste après le dernier 
+ * octet hors de l'alphabet qui la précède. Renvoie 'fin' si le facteur 
+ * n'apparaît plus. '*limite' reçoit la position qui suit le début du 
+ * facteur trouvé : avant elle, il ne faut pas chercher de nouveau le 
+ * facteur.
+ */
+const uint8_t * sauter_facteur_recherche(
+    const Automate_recherche * automate,
+    const uint8_t * debut, const uint8_t * fin, const uint8_t ** limite
+){
+    const uint8_t * p = memmem( 
+        debut, fin - debut, automate->facteur, automate->taille_facteur 
+    );
+    if( ! p ) return fin;
+    *limite = p + 1;
+    while( p > debut && automate->dense->classes[ p[-1] ] != 0 ) p--;
+    return sauter_octets_recherche( automate, p, fin );
+}
+
+void rechercher_occurrences(
+    const Automate_recherche * automate, const uint8_t * texte, size_t taille,
+    void (* action )( size_t fin, void* data ), void* data
+){
+    const Automate_dense * dense = automate->dense;
+    const int * transitions = dense->transitions;
+    const uint16_t * classes = dense->classes;
+    const unsigned char * finaux = automate->finaux;
+    const uint8_t * lettre = texte;
+    const uint8_t * fin = texte + taille;
+    int initial = dense->initial;
+    int etat = initial;
+    const uint8_t * limite = texte;
+
+    if( finaux[initial] ){
+        // Le mot vide est reconnu : chaque position est une occurrence.
+        size_t i;
+        for( i=0; i<=taille; i++ ) action( i, data );
+        return;
+    }
+    while( lettre < fin ){
+        if( etat == initial ){
+            if( automate->facteur && lettre >= limite ){
+                lettre = sauter_facteur_recherche( 
+                    automate, lettre, fin, &limite 
+                );
+            }else{
+                lettre = sauter_octets_recherche( automate, lettre, fin );
+            }
+            if( lettre == fin ) break;
+        }
+        etat = transitions[ etat + classes[ *lettre++ ] ];
+        if( finaux[etat] ) action( lettre - texte, data );
+    }
+}
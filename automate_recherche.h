@@ -0,0 +1,115 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_recherche.h */ 
+
+#ifndef __AUTOMATE_RECHERCHE_H__
+#define __AUTOMATE_RECHERCHE_H__
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "rationnel.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Un automate compilé pour chercher toutes les occurrences de son 
+ *        langage dans un texte.
+ *
+ * On compile l'automate déterministe de A*L, où L est le langage de 
+ * l'automate et A l'ensemble de tous les octets : après avoir lu les i 
+ * premiers octets du texte, il est dans un état final si et seulement si un
+ * facteur du texte qui finit en i est dans L. Le texte est donc lu une seule
+ * fois, sans jamais revenir en arrière.
+ *
+ * Tant qu'aucune occurrence n'est commencée, l'automate est dans son état 
+ * initial et seuls les octets de 'premieres' (les lettres des transitions 
+ * qui partent des états initiaux) peuvent en commencer une : les autres 
+ * octets sont sautés sans consulter la table, avec memchr() s'il n'y a 
+ * qu'une première lettre possible.
+ *
+ * Si l'automate est compilé depuis une expression qui a un facteur 
+ * obligatoire (voir facteur_obligatoire()), la recherche saute avec 
+ * memmem() jusqu'à la prochaine apparition du facteur, puis revient au 
+ * dernier octet hors de l'alphabet qui la précède : aucune occurrence ne 
+ * peut contenir cet octet, et l'automate ne lit que la fin du texte 
+ * qui l'entoure.
+ */
+typedef struct Automate_recherche {
+	Automate_dense * dense;
+	unsigned char * finaux;         //!< 1 pour le décalage d'un état final
+	unsigned char premieres[256];   //!< 1 si l'octet peut commencer un mot
+	int nb_premieres;
+	unsigned char premiere;         //!< La première lettre, s'il n'y en a qu'une
+	char * facteur;                 //!< Le facteur obligatoire, ou NULL
+	size_t taille_facteur;
+} Automate_recherche;
+
+/**
+ * @brief Compile un automate pour la recherche de ses occurrences.
+ *
+ * L'automate peut être non déterministe ; il est déterminisé par 
+ * creer_automate_deterministe(). Il peut ensuite être modifié ou détruit.
+ *
+ * @param automate Un automate.
+ * @return L'automate compilé, à libérer avec liberer_automate_recherche().
+ */
+Automate_recherche * compiler_automate_recherche( const Automate * automate );
+
+/**
+ * @brief Compile l'automate de Glushkov d'une expression pour la recherche 
+ *        de ses occurrences, avec son facteur obligatoire comme filtre.
+ *
+ * Le facteur n'est gardé que s'il a au moins deux lettres : pour une seule 
+ * lettre, le filtre sur les premières lettres est aussi efficace.
+ *
+ * @param rat Une expression rationnelle.
+ * @return L'automate compilé, à libérer avec liberer_automate_recherche().
+ */
+Automate_recherche * compiler_rationnel_recherche( Rationnel * rat );
+
+/**
+ * @brief Libère la mémoire d'un automate compilé pour la recherche.
+ */
+void liberer_automate_recherche( Automate_recherche * automate );
+
+/**
+ * @brief Cherche toutes les occurrences du langage de l'automate dans un 
+ *        texte.
+ *
+ * Pour chaque position 'fin' de 0 à 'taille' telle qu'un facteur du texte 
+ * qui finit en 'fin' (c'est-à-dire juste avant l'octet texte[fin]) est 
+ * reconnu par l'automate, la fonction appelle action( fin, data ), dans 
+ * l'ordre croissant des positions. La position 0 n'est signalée que si 
+ * l'automate reconnaît le mot vide.
+ *
+ * @param automate Un automate compilé pour la recherche.
+ * @param texte Le texte, qui peut contenir des octets nuls.
+ * @param taille Le nombre d'octets du texte.
+ * @param action La fonction appelée pour chaque occurrence.
+ * @param data La donnée passée à 'action'.
+ */
+void rechercher_occurrences(
+	const Automate_recherche * automate, const uint8_t * texte, size_t taille,
+	void (* action )( size_t fin, void* data ), void* data
+);
+
+#endif
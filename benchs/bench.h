@@ -0,0 +1,112 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Outils communs aux programmes de mesure du répertoire benchs/.
+ *
+ * Les programmes sont liés avec 
+ *     -Wl,--wrap=malloc,--wrap=free,--wrap=realloc,--wrap=calloc
+ * ce qui permet de compter les allocations faites par la bibliothèque, 
+ * y compris par les fils qu'elle lance : les compteurs sont incrémentés de 
+ * façon atomique.
+ * Ce fichier ne doit être inclus que par le fichier principal d'un programme.
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+size_t nb_malloc = 0;
+size_t nb_free = 0;
+
+#define COMPTER( compteur ) __atomic_fetch_add( &( compteur ), 1, __ATOMIC_RELAXED )
+#define LIRE_COMPTEUR( compteur ) __atomic_load_n( &( compteur ), __ATOMIC_RELAXED )
+
+void* __real_malloc( size_t n );
+void* __real_realloc( void* ptr, size_t n );
+void* __real_calloc( size_t nb, size_t n );
+void __real_free( void* ptr );
+
+void* __wrap_malloc( size_t n ){
+	COMPTER( nb_malloc );
+	return __real_malloc( n );
+}
+
+void* __wrap_realloc( void* ptr, size_t n ){
+	if( ! ptr ) COMPTER( nb_malloc );
+	return __real_realloc( ptr, n );
+}
+
+void* __wrap_calloc( size_t nb, size_t n ){
+	COMPTER( nb_malloc );
+	return __real_calloc( nb, n );
+}
+
+void __wrap_free( void* ptr ){
+	if( ptr ) COMPTER( nb_free );
+	__real_free( ptr );
+}
+
+/*
+ * Renvoie un temps en secondes, à utiliser par différence.
+ */
+double chrono(){
+	struct timespec t;
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/*
+ * Mémorise l'état des compteurs au début d'une mesure.
+ */
+typedef struct {
+	double temps;
+	size_t nb_malloc;
+	size_t nb_free;
+} Mesure;
+
+Mesure debut_mesure(){
+	Mesure m;
+	m.nb_malloc = LIRE_COMPTEUR( nb_malloc );
+	m.nb_free = LIRE_COMPTEUR( nb_free );
+	m.temps = chrono();
+	return m;
+}
+
+/*
+ * Affiche le temps et le nombre d'allocations, ramenés à une opération,
+ * depuis le début de la mesure 'm'.
+ */
+void fin_mesure( const char* nom, Mesure m, size_t nb_operations ){
+	double temps = chrono() - m.temps;
+	printf(
+		"%-40s %10.1f ns/op %8.2f malloc/op %8.2f free/op\n", nom,
+		temps * 1e9 / nb_operations,
+		(double) ( LIRE_COMPTEUR( nb_malloc ) - m.nb_malloc ) / nb_operations,
+		(double) ( LIRE_COMPTEUR( nb_free ) - m.nb_free ) / nb_operations
+	);
+}
+
+#endif
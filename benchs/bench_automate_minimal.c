@@ -0,0 +1,73 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure le coût de creer_automate_minimal(), qui construit et détruit 
+ * trois automates intermédiaires, en temps et en nombre d'allocations.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+
+#define PROFONDEUR 9
+#define NB_REPETITIONS 5
+
+/*
+ * Automate non déterministe de (a+b)*a(a+b)^PROFONDEUR, dont l'automate 
+ * déterministe a 2^(PROFONDEUR+1) états.
+ */
+Automate * creer_automate_bench(){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	return automate;
+}
+
+int main(){
+	Automate * automate = creer_automate_bench();
+	int i;
+
+	Mesure m = debut_mesure();
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		liberer_automate( creer_automate_minimal( automate ) );
+	}
+	fin_mesure( "creer_automate_minimal + liberer", m, NB_REPETITIONS );
+
+	Automate * minimal = creer_automate_minimal( automate );
+	m = debut_mesure();
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		liberer_automate( copier_automate( minimal ) );
+	}
+	fin_mesure( "copier_automate + liberer", m, NB_REPETITIONS );
+	printf( "%d états\n", taille_ensemble( get_etats( minimal ) ) );
+
+	liberer_automate( minimal );
+	liberer_automate( automate );
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la déterminisation (creer_automate_deterministe()) d'automates 
+ * dont le déterminisé est grand.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "outils.h"
+
+#define PROFONDEUR 14
+#define NB_ETATS_ALEATOIRE 40
+
+void mesurer( const char * nom, const Automate * automate ){
+	Mesure m = debut_mesure();
+	Automate * deterministe = creer_automate_deterministe( automate );
+	int n = taille_ensemble( get_etats( deterministe ) );
+	char titre[128];
+	snprintf( titre, sizeof(titre), "%s (par état du déterminisé)", nom );
+	fin_mesure( titre, m, n );
+	printf( "%d états\n", n );
+	liberer_automate( deterministe );
+}
+
+int main(){
+	int i;
+
+	// (a+b)*a(a+b)^PROFONDEUR : 2^(PROFONDEUR+1) sous-ensembles de petite 
+	// taille
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	mesurer( "(a+b)*a(a+b)^14", automate );
+	liberer_automate( automate );
+
+	// Automate pseudo-aléatoire sur 4 lettres, 3 transitions par état et 
+	// par lettre : sous-ensembles de grande taille
+	automate = creer_automate();
+	unsigned int graine = 1;
+	ajouter_etat_initial( automate, 0 );
+	for( i=0; i<NB_ETATS_ALEATOIRE; i++ ){
+		const char * lettre;
+		for( lettre = "abcd"; *lettre; lettre++ ){
+			int t;
+			for( t=0; t<3; t++ ){
+				graine = graine * 1103515245 + 12345;
+				int fin = ( graine >> 8 ) % ( 2 * NB_ETATS_ALEATOIRE );
+				if( fin < NB_ETATS_ALEATOIRE ){
+					ajouter_transition( automate, i, *lettre, fin );
+				}
+			}
+		}
+		graine = graine * 1103515245 + 12345;
+		if( ( graine >> 16 ) % 8 == 0 ) ajouter_etat_final( automate, i );
+	}
+	mesurer( "aléatoire 40 états", automate );
+	liberer_automate( automate );
+	return 0;
+}
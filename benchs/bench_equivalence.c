@@ -0,0 +1,101 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la comparaison de deux automates non déterministes, par leurs 
+ * formes canoniques (creer_automate_canonique()) et par l'algorithme de 
+ * Hopcroft et Karp (automates_equivalents()).
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_equivalence.h"
+#include "outils.h"
+
+#define PROFONDEUR 14
+
+/*
+ * Automate non déterministe de (a+b)*.x.(a+b)^PROFONDEUR.
+ */
+Automate * creer_automate_lettre_avant_la_fin( char x ){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, x, 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	return automate;
+}
+
+void mesurer( const char * nom, const Automate * a1, const Automate * a2 ){
+	char titre[128];
+	Mesure m;
+
+	m = debut_mesure();
+	Automate * c1 = creer_automate_canonique( a1 );
+	Automate * c2 = creer_automate_canonique( a2 );
+	int egaux = automates_canoniques_egaux( c1, c2 );
+	snprintf( titre, sizeof(titre), "%s, formes canoniques", nom );
+	fin_mesure( titre, m, 1 );
+	printf( "égaux : %d\n", egaux );
+	liberer_automate( c1 );
+	liberer_automate( c2 );
+
+	uint8_t * mot = NULL;
+	size_t taille = 0;
+	m = debut_mesure();
+	egaux = automates_equivalents( a1, a2, &mot, &taille );
+	snprintf( titre, sizeof(titre), "%s, Hopcroft et Karp", nom );
+	fin_mesure( titre, m, 1 );
+	printf( "égaux : %d", egaux );
+	if( ! egaux ) printf( ", contre-exemple de %zu lettres", taille );
+	printf( "\n" );
+	xfree( mot );
+}
+
+int main(){
+	Automate * a = creer_automate_lettre_avant_la_fin( 'a' );
+	Automate * b = creer_automate_lettre_avant_la_fin( 'b' );
+
+	// Même langage, mais l'un des deux automates a des états en double.
+	Automate * double_a = creer_automate_lettre_avant_la_fin( 'a' );
+	int i;
+	ajouter_transition( double_a, 0, 'a', 101 );
+	for( i=1; i<PROFONDEUR; i++ ){
+		ajouter_transition( double_a, 100+i, 'a', 100+i+1 );
+		ajouter_transition( double_a, 100+i, 'b', 100+i+1 );
+	}
+	ajouter_transition( double_a, 100+PROFONDEUR, 'a', PROFONDEUR+1 );
+	ajouter_transition( double_a, 100+PROFONDEUR, 'b', PROFONDEUR+1 );
+
+	mesurer( "(a+b)*a(a+b)^14, langages égaux", a, double_a );
+	mesurer( "(a+b)*a(a+b)^14 et (a+b)*b(a+b)^14", a, b );
+
+	liberer_automate( a );
+	liberer_automate( b );
+	liberer_automate( double_a );
+	return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure les tests d'inclusion et d'universalité par antichaînes 
+ * (langage_inclus(), automate_universel()) et par le déterminisé du second
+ * automate (automates_equivalents() sur une intersection).
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_equivalence.h"
+#include "outils.h"
+
+#define PROFONDEUR 14
+
+/*
+ * Ajoute à l'automate les états de (a+b)*.x.(a+b)^PROFONDEUR, à partir de 
+ * l'état 'debut' qui est initial.
+ */
+void ajouter_lettre_avant_la_fin( Automate * automate, int debut, char x ){
+	int i;
+	ajouter_etat_initial( automate, debut );
+	ajouter_transition( automate, debut, 'a', debut );
+	ajouter_transition( automate, debut, 'b', debut );
+	ajouter_transition( automate, debut, x, debut+1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, debut+i, 'a', debut+i+1 );
+		ajouter_transition( automate, debut+i, 'b', debut+i+1 );
+	}
+	ajouter_etat_final( automate, debut+PROFONDEUR+1 );
+}
+
+void mesurer( const char * nom, const Automate * a1, const Automate * a2 ){
+	char titre[128];
+	Mesure m;
+
+	m = debut_mesure();
+	Automate * intersection = creer_intersection_des_automates( a1, a2 );
+	int inclus = automates_equivalents( intersection, a1, NULL, NULL );
+	snprintf( titre, sizeof(titre), "%s, par déterminisation", nom );
+	fin_mesure( titre, m, 1 );
+	printf( "inclus : %d\n", inclus );
+	liberer_automate( intersection );
+
+	size_t taille = 0;
+	uint8_t * mot = NULL;
+	m = debut_mesure();
+	inclus = langage_inclus( a1, a2, &mot, &taille );
+	snprintf( titre, sizeof(titre), "%s, par antichaînes", nom );
+	fin_mesure( titre, m, 1 );
+	printf( "inclus : %d", inclus );
+	if( ! inclus ) printf( ", contre-exemple de %zu lettres", taille );
+	printf( "\n" );
+	xfree( mot );
+}
+
+/*
+ * Ajoute à l'automate l'état 'etat', initial et final, qui reconnaît tous 
+ * les mots sur {a, b}.
+ */
+void ajouter_tout( Automate * automate, int etat ){
+	ajouter_etat_initial( automate, etat );
+	ajouter_etat_final( automate, etat );
+	ajouter_transition( automate, etat, 'a', etat );
+	ajouter_transition( automate, etat, 'b', etat );
+}
+
+int main(){
+	// Une règle large qui couvre les autres : le déterminisé de la réunion 
+	// a 2^15 états, mais les antichaînes n'en gardent que quelques-uns.
+	// a1 : (a+b)*a(a+b)^14, a2 : (a+b)*b(a+b)^14 + (a+b)*
+	Automate * a1 = creer_automate();
+	ajouter_lettre_avant_la_fin( a1, 0, 'a' );
+	Automate * a2 = creer_automate();
+	ajouter_lettre_avant_la_fin( a2, 0, 'b' );
+	ajouter_tout( a2, 100 );
+	mesurer( "a1 inclus dans a2 (règle large)", a1, a2 );
+	liberer_automate( a2 );
+
+	// Contre-exemple : a2 : (a+b)*b(a+b)^14 + a*
+	a2 = creer_automate();
+	ajouter_lettre_avant_la_fin( a2, 0, 'b' );
+	ajouter_etat_initial( a2, 100 );
+	ajouter_etat_final( a2, 100 );
+	ajouter_transition( a2, 100, 'a', 100 );
+	mesurer( "a1 inclus dans a2 (contre-exemple)", a1, a2 );
+	liberer_automate( a2 );
+
+	a2 = creer_automate();
+	ajouter_lettre_avant_la_fin( a2, 0, 'a' );
+	ajouter_lettre_avant_la_fin( a2, 100, 'b' );
+	ajouter_tout( a2, 200 );
+	Automate * tout = creer_automate();
+	ajouter_tout( tout, 0 );
+	Mesure m = debut_mesure();
+	int universel = automates_equivalents( a2, tout, NULL, NULL );
+	fin_mesure( "universalité (règle large), par déterminisation", m, 1 );
+	printf( "universel : %d\n", universel );
+	m = debut_mesure();
+	universel = automate_universel( a2, NULL, NULL );
+	fin_mesure( "universalité (règle large), par antichaînes", m, 1 );
+	printf( "universel : %d\n", universel );
+	liberer_automate( a2 );
+
+	// Pire cas des antichaînes : tous les ensembles atteints sont 
+	// incomparables, et chacun est comparé à tous les autres.
+	// a2 : (a+b)*a(a+b)^14 + (a+b)*b(a+b)^14
+	a2 = creer_automate();
+	ajouter_lettre_avant_la_fin( a2, 0, 'a' );
+	ajouter_lettre_avant_la_fin( a2, 100, 'b' );
+	mesurer( "a1 inclus dans a2 (pire cas)", a1, a2 );
+
+	liberer_automate( tout );
+	liberer_automate( a1 );
+	liberer_automate( a2 );
+	return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la lecture d'un long mot sur un automate dense, par un seul fil ou
+ * par tranches sur plusieurs fils, pour un automate dont les lectures se 
+ * rejoignent vite et pour un automate où elles ne se rejoignent jamais.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "automate_parallele.h"
+#include "outils.h"
+
+#define TAILLE_TEXTE ( 64 * 1024 * 1024 )
+
+void mesurer( const char * nom, const Automate * automate, const char * texte ){
+	Automate_dense * dense = compiler_automate( automate );
+	char titre[128];
+	int nb_fils[] = { 1, 2, 4, 8 };
+	int i;
+	Mesure m = debut_mesure();
+	Lecture_dense lecture;
+	commencer_lecture_dense( &lecture, dense );
+	lire_morceau_dense( &lecture, texte, TAILLE_TEXTE );
+	snprintf( titre, sizeof(titre), "%s, lire_morceau_dense (par octet)", nom );
+	fin_mesure( titre, m, TAILLE_TEXTE );
+	for( i=0; i<4; i++ ){
+		m = debut_mesure();
+		commencer_lecture_dense( &lecture, dense );
+		lire_morceau_dense_parallele( &lecture, texte, TAILLE_TEXTE, nb_fils[i] );
+		snprintf( titre, sizeof(titre), "%s, %d fils (par octet)", nom, nb_fils[i] );
+		fin_mesure( titre, m, TAILLE_TEXTE );
+	}
+	liberer_automate_dense( dense );
+}
+
+int main(){
+	char * texte = xmalloc( TAILLE_TEXTE );
+	unsigned int graine = 1;
+	int i;
+	for( i=0; i<TAILLE_TEXTE; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = ( ( graine >> 16 ) & 1 ) ? 'a' : 'b';
+	}
+
+	// Déterminisé de (a+b)*a(a+b)^8
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=8; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, 9 );
+	Automate * deterministe = creer_automate_deterministe( automate );
+	mesurer( "(a+b)*a(a+b)^8", deterministe, texte );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	// Parité du nombre de a
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 1, 'a', 0 );
+	ajouter_transition( automate, 1, 'b', 1 );
+	ajouter_etat_final( automate, 1 );
+	mesurer( "parité de a", automate, texte );
+	liberer_automate( automate );
+
+	xfree( texte );
+	return 0;
+}
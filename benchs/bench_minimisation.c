@@ -0,0 +1,98 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la minimisation d'automates déterministes par l'algorithme de 
+ * Brzozowski (creer_automate_minimal()) et par celui de Hopcroft 
+ * (creer_automate_minimal_hopcroft()).
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "outils.h"
+
+#define PROFONDEUR 9
+#define NB_ETATS_ALEATOIRE 100000
+
+void mesurer( const char * nom, const Automate * automate, int avec_brzozowski ){
+	char titre[128];
+	Mesure m;
+	Automate * minimal;
+	int n = taille_ensemble( get_etats( automate ) );
+	if( avec_brzozowski ){
+		m = debut_mesure();
+		minimal = creer_automate_minimal( automate );
+		snprintf( titre, sizeof(titre), "%s, Brzozowski (par état)", nom );
+		fin_mesure( titre, m, n );
+		printf( "%d états\n", taille_ensemble( get_etats( minimal ) ) );
+		liberer_automate( minimal );
+	}
+	m = debut_mesure();
+	minimal = creer_automate_minimal_hopcroft( automate );
+	snprintf( titre, sizeof(titre), "%s, Hopcroft (par état)", nom );
+	fin_mesure( titre, m, n );
+	printf( "%d états\n", taille_ensemble( get_etats( minimal ) ) );
+	liberer_automate( minimal );
+}
+
+int main(){
+	int i;
+
+	// Déterminisé de (a+b)*a(a+b)^PROFONDEUR, déjà minimal
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	Automate * deterministe = creer_automate_deterministe( automate );
+	mesurer( "(a+b)*a(a+b)^9", deterministe, 1 );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	// Automate déterministe pseudo-aléatoire où les états i et 
+	// i + NB_ETATS_ALEATOIRE/2 sont équivalents.
+	automate = creer_automate();
+	unsigned int graine = 1;
+	int moitie = NB_ETATS_ALEATOIRE / 2;
+	ajouter_etat_initial( automate, 0 );
+	for( i=0; i<moitie; i++ ){
+		const char * lettre;
+		for( lettre = "ab"; *lettre; lettre++ ){
+			graine = graine * 1103515245 + 12345;
+			int fin = ( graine >> 8 ) % NB_ETATS_ALEATOIRE;
+			ajouter_transition( automate, i, *lettre, fin );
+			ajouter_transition( automate, i + moitie, *lettre, fin );
+		}
+		graine = graine * 1103515245 + 12345;
+		if( ( graine >> 16 ) % 2 ){
+			ajouter_etat_final( automate, i );
+			ajouter_etat_final( automate, i + moitie );
+		}
+	}
+	mesurer( "aléatoire 100000 états", automate, 0 );
+	liberer_automate( automate );
+	return 0;
+}
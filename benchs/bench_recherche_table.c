@@ -0,0 +1,135 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure le coût des recherches dans les tables 
+ * (est_une_transition_de_l_automate(), est_dans_l_ensemble()) et de la 
+ * reconnaissance d'un mot, en temps et en 
+ * nombre d'allocations.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_fige.h"
+#include "automate_dense.h"
+#include "automate_bits.h"
+#include "automate_paresseux.h"
+#include "ensemble.h"
+#include "outils.h"
+#include "rationnel.h"
+
+#include <string.h>
+
+#define TAILLE_MOT 100000
+#define NB_RECHERCHES 1000000
+#define PROFONDEUR 8
+
+/*
+ * Automate non déterministe de (a+b)*a(a+b)^PROFONDEUR : après quelques
+ * lettres, PROFONDEUR états sont actifs en même temps.
+ */
+Automate * creer_automate_bench(){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	return automate;
+}
+
+int main(){
+	Automate * automate = creer_automate_bench();
+	Mesure m;
+	int i;
+	volatile intptr_t puits = 0;
+
+	m = debut_mesure();
+	for( i=0; i<NB_RECHERCHES; i++ ){
+		puits += est_une_transition_de_l_automate( 
+			automate, i % (PROFONDEUR+1), ( i & 1 ) ? 'a' : 'b', i % 3
+		);
+	}
+	fin_mesure( "est_une_transition_de_l_automate", m, NB_RECHERCHES );
+
+	// Ensemble rangé dans un AVL
+	const Ensemble * etats = get_etats( automate );
+	m = debut_mesure();
+	for( i=0; i<NB_RECHERCHES; i++ ){
+		puits += est_dans_l_ensemble( etats, i % ( 2*PROFONDEUR ) );
+	}
+	fin_mesure( "est_dans_l_ensemble (avl)", m, NB_RECHERCHES );
+
+	char * mot = xmalloc( TAILLE_MOT + 1 );
+	unsigned int graine = 1;
+	for( i=0; i<TAILLE_MOT; i++ ){
+		graine = graine * 1103515245 + 12345;
+		mot[i] = ( ( graine >> 16 ) & 1 ) ? 'a' : 'b';
+	}
+	mot[TAILLE_MOT] = '\0';
+
+	m = debut_mesure();
+	puits += le_mot_est_reconnu( automate, mot );
+	fin_mesure( "le_mot_est_reconnu (par lettre)", m, TAILLE_MOT );
+
+	Automate_fige * fige = figer_automate( automate );
+	m = debut_mesure();
+	puits += le_mot_est_reconnu_fige( fige, mot );
+	fin_mesure( "le_mot_est_reconnu_fige (par lettre)", m, TAILLE_MOT );
+	liberer_automate_fige( fige );
+
+	Automate * deterministe = creer_automate_deterministe( automate );
+	Automate_dense * dense = compiler_automate( deterministe );
+	m = debut_mesure();
+	puits += le_mot_est_reconnu_dense( dense, mot );
+	fin_mesure( "le_mot_est_reconnu_dense (par lettre)", m, TAILLE_MOT );
+	liberer_automate_dense( dense );
+	liberer_automate( deterministe );
+
+	Automate_paresseux * paresseux = creer_automate_paresseux( automate, 1 << 20 );
+	m = debut_mesure();
+	puits += le_mot_est_reconnu_paresseux( paresseux, mot );
+	fin_mesure( "le_mot_est_reconnu_paresseux (par lettre)", m, TAILLE_MOT );
+	m = debut_mesure();
+	puits += le_mot_est_reconnu_paresseux( paresseux, mot );
+	fin_mesure( "  cache rempli", m, TAILLE_MOT );
+	liberer_automate_paresseux( paresseux );
+
+	// Le même langage, (a+b)*.a.(a+b)^PROFONDEUR, par son automate de 
+	// Glushkov
+	char expression[16 + 6*PROFONDEUR] = "(a+b)*.a";
+	for( i=0; i<PROFONDEUR; i++ ) strcat( expression, ".(a+b)" );
+	Automate_bits * bits = 
+		compiler_rationnel_bits( expression_to_rationnel( expression ) );
+	m = debut_mesure();
+	puits += le_mot_est_reconnu_bits( bits, mot );
+	fin_mesure( "le_mot_est_reconnu_bits (par lettre)", m, TAILLE_MOT );
+	liberer_automate_bits( bits );
+
+	xfree( mot );
+	liberer_automate( automate );
+	return 0;
+}
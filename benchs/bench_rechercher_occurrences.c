@@ -0,0 +1,121 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la recherche de toutes les occurrences d'un langage dans un grand 
+ * texte, avec une première lettre rare (memchr), avec plusieurs premières 
+ * lettres, et sans filtre possible ; puis, dans un texte en lignes, le 
+ * filtre sur le facteur obligatoire d'une expression.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_recherche.h"
+#include "outils.h"
+
+#define TAILLE_TEXTE ( 16 * 1024 * 1024 )
+
+void action_compter( size_t fin, void* data ){
+	( *(size_t*) data )++;
+}
+
+/*
+ * Automate de premiere.(a+b)*.c
+ */
+Automate * creer_automate_bench( const char * premieres ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	for( ; *premieres; premieres++ ){
+		ajouter_transition( automate, 0, *premieres, 1 );
+	}
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 1 );
+	ajouter_transition( automate, 1, 'c', 2 );
+	ajouter_etat_final( automate, 2 );
+	return automate;
+}
+
+void mesurer( const char * nom, const char * premieres, const uint8_t * texte ){
+	Automate * automate = creer_automate_bench( premieres );
+	Automate_recherche * recherche = compiler_automate_recherche( automate );
+	size_t nb = 0;
+	Mesure m = debut_mesure();
+	rechercher_occurrences( 
+		recherche, texte, TAILLE_TEXTE, action_compter, &nb 
+	);
+	fin_mesure( nom, m, TAILLE_TEXTE );
+	printf( "%zu occurrences\n", nb );
+	liberer_automate_recherche( recherche );
+	liberer_automate( automate );
+}
+
+void mesurer_expression( 
+	const char * nom, const char * expression, int avec_facteur, 
+	const uint8_t * texte 
+){
+	Rationnel * rat = expression_to_rationnel( expression );
+	Automate_recherche * recherche;
+	if( avec_facteur ){
+		recherche = compiler_rationnel_recherche( rat );
+	}else{
+		Automate * glushkov = Glushkov( rat );
+		recherche = compiler_automate_recherche( glushkov );
+		liberer_automate( glushkov );
+	}
+	size_t nb = 0;
+	Mesure m = debut_mesure();
+	rechercher_occurrences( 
+		recherche, texte, TAILLE_TEXTE, action_compter, &nb 
+	);
+	fin_mesure( nom, m, TAILLE_TEXTE );
+	printf( "%zu occurrences\n", nb );
+	liberer_automate_recherche( recherche );
+}
+
+int main(){
+	// Un texte de lettres minuscules, où 'z' est rare
+	uint8_t * texte = xmalloc( TAILLE_TEXTE );
+	unsigned int graine = 1;
+	int i;
+	for( i=0; i<TAILLE_TEXTE; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = 'a' + ( graine >> 16 ) % 25;
+		if( ( graine >> 8 ) % 4096 == 0 ) texte[i] = 'z';
+	}
+
+	mesurer( "rechercher_occurrences z (par octet)", "z", texte );
+	mesurer( "rechercher_occurrences xyz (par octet)", "xyz", texte );
+	mesurer( "rechercher_occurrences a-y (par octet)", "abcdefghijklmnopqrstuvwxy", texte );
+
+	// Des lignes de 64 octets
+	for( i=63; i<TAILLE_TEXTE; i+=64 ) texte[i] = '\n';
+	mesurer_expression( 
+		"rechercher_occurrences (a+b)*.x.y.z.a* sans facteur (par octet)", 
+		"(a+b)*.x.y.z.a*", 0, texte 
+	);
+	mesurer_expression( 
+		"rechercher_occurrences (a+b)*.x.y.z.a* avec facteur (par octet)", 
+		"(a+b)*.x.y.z.a*", 1, texte 
+	);
+
+	xfree( texte );
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la reconnaissance d'un grand nombre de mots courts sur le même 
+ * automate : un appel à le_mot_est_reconnu() par mot, ou un seul appel à 
+ * reconnaitre_lot().
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_lot.h"
+#include "outils.h"
+
+#define NB_MOTS 1000000
+#define TAILLE_MAX 32
+#define PROFONDEUR 8
+
+/*
+ * Automate non déterministe de (a+b)*a(a+b)^PROFONDEUR.
+ */
+Automate * creer_automate_bench(){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	return automate;
+}
+
+int main(){
+	Automate * automate = creer_automate_bench();
+	Automate * deterministe = creer_automate_deterministe( automate );
+	Mesure m;
+	int i;
+	volatile intptr_t puits = 0;
+
+	// Les mots se suivent dans un texte, séparés par un octet nul.
+	char * texte = xmalloc( NB_MOTS * ( TAILLE_MAX + 1 ) );
+	const uint8_t ** mots = xmalloc( NB_MOTS * sizeof(uint8_t*) );
+	size_t * tailles = xmalloc( NB_MOTS * sizeof(size_t) );
+	uint64_t * resultats = xmalloc( ( NB_MOTS / 64 + 1 ) * sizeof(uint64_t) );
+	unsigned int graine = 1;
+	char * position = texte;
+	size_t j;
+	for( i=0; i<NB_MOTS; i++ ){
+		graine = graine * 1103515245 + 12345;
+		tailles[i] = ( graine >> 16 ) % TAILLE_MAX + 1;
+		mots[i] = (const uint8_t*) position;
+		for( j=0; j<tailles[i]; j++ ){
+			graine = graine * 1103515245 + 12345;
+			*position++ = ( ( graine >> 16 ) & 1 ) ? 'a' : 'b';
+		}
+		*position++ = '\0';
+	}
+
+	m = debut_mesure();
+	for( i=0; i<NB_MOTS; i++ ){
+		puits += le_mot_est_reconnu( deterministe, (const char*) mots[i] );
+	}
+	fin_mesure( "le_mot_est_reconnu (par mot)", m, NB_MOTS );
+
+	m = debut_mesure();
+	reconnaitre_lot( automate, mots, tailles, NB_MOTS, resultats, 1 );
+	fin_mesure( "reconnaitre_lot, non dét. (par mot)", m, NB_MOTS );
+
+	m = debut_mesure();
+	reconnaitre_lot( deterministe, mots, tailles, NB_MOTS, resultats, 1 );
+	fin_mesure( "reconnaitre_lot, 1 fil (par mot)", m, NB_MOTS );
+
+	m = debut_mesure();
+	reconnaitre_lot( deterministe, mots, tailles, NB_MOTS, resultats, 4 );
+	fin_mesure( "reconnaitre_lot, 4 fils (par mot)", m, NB_MOTS );
+
+	xfree( resultats );
+	xfree( tailles );
+	xfree( mots );
+	xfree( texte );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+	return 0;
+}
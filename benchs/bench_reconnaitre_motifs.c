@@ -0,0 +1,109 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure la reconnaissance de mots par un grand nombre d'expressions : un 
+ * automate dense par expression, ou un seul automate à motifs.
+ */
+
+#include "bench.h"
+
+#include "automate.h"
+#include "automate_dense.h"
+#include "automate_motifs.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#define NB_MOTIFS 200
+#define NB_MOTS 100000
+#define TAILLE_MAX 32
+
+int main(){
+	// Le motif m est (a+b+c+d)*.x.y.z où x, y, z sont les chiffres de m en
+	// base 4, écrits sur {a, b, c, d}.
+	char expressions[NB_MOTIFS][64];
+	const char * pointeurs[NB_MOTIFS];
+	Automate_dense * denses[NB_MOTIFS];
+	int i, k;
+	for( i=0; i<NB_MOTIFS; i++ ){
+		sprintf( 
+			expressions[i], "(a+b+c+d)*.%c.%c.%c.%c", "abcd"[ i / 64 % 4 ],
+			"abcd"[ i / 16 % 4 ], "abcd"[ i / 4 % 4 ], "abcd"[ i % 4 ]
+		);
+		pointeurs[i] = expressions[i];
+		Automate * glushkov = 
+			Glushkov( expression_to_rationnel( expressions[i] ) );
+		Automate * deterministe = creer_automate_deterministe( glushkov );
+		denses[i] = compiler_automate( deterministe );
+		liberer_automate( deterministe );
+		liberer_automate( glushkov );
+	}
+	Mesure m = debut_mesure();
+	Automate_motifs * motifs = compiler_expressions_motifs( pointeurs, NB_MOTIFS );
+	fin_mesure( "compiler_expressions_motifs", m, 1 );
+	printf( "%d états, %d classes\n", motifs->nb_etats, motifs->nb_classes );
+
+	char * texte = xmalloc( NB_MOTS * ( TAILLE_MAX + 1 ) );
+	char ** mots = xmalloc( NB_MOTS * sizeof(char*) );
+	size_t * tailles = xmalloc( NB_MOTS * sizeof(size_t) );
+	unsigned int graine = 1;
+	char * position = texte;
+	size_t j;
+	for( i=0; i<NB_MOTS; i++ ){
+		graine = graine * 1103515245 + 12345;
+		tailles[i] = ( graine >> 16 ) % TAILLE_MAX + 1;
+		mots[i] = position;
+		for( j=0; j<tailles[i]; j++ ){
+			graine = graine * 1103515245 + 12345;
+			*position++ = "abcd"[ ( graine >> 16 ) % 4 ];
+		}
+		*position++ = '\0';
+	}
+
+	size_t nb_dense = 0, nb_motifs = 0;
+	m = debut_mesure();
+	for( i=0; i<NB_MOTS; i++ ){
+		for( k=0; k<NB_MOTIFS; k++ ){
+			nb_dense += le_mot_est_reconnu_dense( denses[k], mots[i] );
+		}
+	}
+	fin_mesure( "le_mot_est_reconnu_dense x 200 (par mot)", m, NB_MOTS );
+
+	m = debut_mesure();
+	for( i=0; i<NB_MOTS; i++ ){
+		const uint64_t * reconnus = reconnaitre_motifs( 
+			motifs, (const uint8_t*) mots[i], tailles[i] 
+		);
+		for( k=0; k<motifs->nb_mots_motifs; k++ ){
+			nb_motifs += __builtin_popcountll( reconnus[k] );
+		}
+	}
+	fin_mesure( "reconnaitre_motifs (par mot)", m, NB_MOTS );
+	printf( "%zu et %zu reconnaissances\n", nb_dense, nb_motifs );
+
+	xfree( tailles );
+	xfree( mots );
+	xfree( texte );
+	liberer_automate_motifs( motifs );
+	for( i=0; i<NB_MOTIFS; i++ ){
+		liberer_automate_dense( denses[i] );
+	}
+	return 0;
+}
@@ -25,10 +25,14 @@
 #include "outils.h"
 #include "table.h"
 
+#include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 
+#define BITS_PAR_MOT 64
+
 int* allouer_element( int val ){
 	int* result = (int*) xmalloc( sizeof(int) );
 	(*result) = val;
@@ -39,62 +43,425 @@ void supprimer_element( int* element ){
 	xfree( element );
 }
 
-void next_iterators( Table_iterateur * it1, Table_iterateur * it2 ){
-	*it1 = iterateur_suivant_table(*it1);
-	*it2 = iterateur_suivant_table(*it2);
+/*
+ * Agrandit le tableau de bits d'un ensemble pour qu'il contienne au moins
+ * 'nb_mots' mots. Les nouveaux mots sont mis à zéro.
+ */
+void reserver_mots( Ensemble * ensemble, size_t nb_mots ){
+	if( nb_mots <= ensemble->nb_mots ) return;
+	size_t nouveau = 2*ensemble->nb_mots;
+	if( nouveau < nb_mots ) nouveau = nb_mots;
+	ensemble->mots = (uint64_t*) reallouer_arena(
+		ensemble->arena, ensemble->mots, 
+		ensemble->nb_mots * sizeof(uint64_t), nouveau * sizeof(uint64_t)
+	);
+	memset(
+		ensemble->mots + ensemble->nb_mots, 0,
+		( nouveau - ensemble->nb_mots ) * sizeof(uint64_t)
+	);
+	ensemble->nb_mots = nouveau;
+}
+
+/*
+ * Renvoie le plus petit élément d'un ensemble bitset supérieur ou égal à 
+ * 'depart', ou -1 s'il n'y en a pas.
+ */
+intptr_t element_bitset_suivant( const Ensemble * ensemble, intptr_t depart ){
+	if( depart < 0 ) depart = 0;
+	size_t i = depart / BITS_PAR_MOT;
+	if( i >= ensemble->nb_mots ) return -1;
+	uint64_t mot = ensemble->mots[i] & ( ~0ULL << ( depart % BITS_PAR_MOT ) );
+	while( ! mot ){
+		i++;
+		if( i >= ensemble->nb_mots ) return -1;
+		mot = ensemble->mots[i];
+	}
+	return i * BITS_PAR_MOT + __builtin_ctzll( mot );
+}
+
+/*
+ * Renvoie le plus grand élément d'un ensemble bitset inférieur ou égal à 
+ * 'depart', ou -1 s'il n'y en a pas.
+ */
+intptr_t element_bitset_precedent( const Ensemble * ensemble, intptr_t depart ){
+	if( depart < 0 ) return -1;
+	size_t i = depart / BITS_PAR_MOT;
+	if( i >= ensemble->nb_mots ){
+		if( ensemble->nb_mots == 0 ) return -1;
+		i = ensemble->nb_mots - 1;
+		depart = BITS_PAR_MOT * ensemble->nb_mots - 1;
+	}
+	int decalage = BITS_PAR_MOT - 1 - ( depart % BITS_PAR_MOT );
+	uint64_t mot = ensemble->mots[i] & ( ~0ULL >> decalage );
+	while( ! mot ){
+		if( i == 0 ) return -1;
+		i--;
+		mot = ensemble->mots[i];
+	}
+	return i * BITS_PAR_MOT + BITS_PAR_MOT - 1 - __builtin_clzll( mot );
+}
+
+void compter_ajout( Ensemble * ensemble, const intptr_t element ){
+	ensemble->cardinal++;
+	ensemble->empreinte ^= hacher_entier( element );
+}
+
+void compter_retrait( Ensemble * ensemble, const intptr_t element ){
+	ensemble->cardinal--;
+	ensemble->empreinte ^= hacher_entier( element );
+}
+
+/*
+ * Compte les éléments d'un masque de bits, dont le premier bit représente
+ * l'élément 'base', comme ajoutés (ou retirés) de l'ensemble.
+ */
+void compter_mot( 
+	Ensemble * ensemble, uint64_t masque, intptr_t base, int ajout
+){
+	while( masque ){
+		intptr_t element = base + __builtin_ctzll( masque );
+		if( ajout ){
+			compter_ajout( ensemble, element );
+		}else{
+			compter_retrait( ensemble, element );
+		}
+		masque &= masque - 1;
+	}
+}
+
+int sont_des_bitsets( const Ensemble* ens1, const Ensemble* ens2 ){
+	return ens1->representation == ENSEMBLE_BITSET 
+		&& ens2->representation == ENSEMBLE_BITSET;
+}
+
+/*
+ * Compare deux ensembles bitset dans l'ordre lexicographique.
+ *
+ * Soit x le plus petit élément de la différence symétrique des deux 
+ * ensembles. Si x est dans ens1, alors t1 est plus petit que t2 si et 
+ * seulement si ens2 contient un élément plus grand que x.
+ */
+int comparer_bitsets( const Ensemble* ens1, const Ensemble* ens2 ){
+	size_t n = ens1->nb_mots < ens2->nb_mots ? ens1->nb_mots : ens2->nb_mots;
+	size_t i;
+	intptr_t x = -1;
+	for( i=0; i<n; i++ ){
+		uint64_t diff = ens1->mots[i] ^ ens2->mots[i];
+		if( diff ){
+			x = i * BITS_PAR_MOT + __builtin_ctzll( diff );
+			break;
+		}
+	}
+	if( x < 0 ){
+		intptr_t x1 = element_bitset_suivant( ens1, n * BITS_PAR_MOT );
+		intptr_t x2 = element_bitset_suivant( ens2, n * BITS_PAR_MOT );
+		if( x1 < 0 && x2 < 0 ) return 0;
+		if( x1 < 0 ) return -1;
+		if( x2 < 0 ) return 1;
+		x = x1 < x2 ? x1 : x2;
+	}
+	if( est_dans_l_ensemble( ens1, x ) ){
+		return element_bitset_suivant( ens2, x+1 ) >= 0 ? -1 : 1;
+	}else{
+		return element_bitset_suivant( ens1, x+1 ) >= 0 ? 1 : -1;
+	}
+}
+
+int comparer_deux_elements(
+	const Ensemble* ensemble, const intptr_t elem1, const intptr_t elem2
+){
+	if( ensemble->comparer_element ){
+		return ensemble->comparer_element( elem1, elem2 );
+	}
+	if( elem1 < elem2 ) return -1;
+	if( elem1 > elem2 ) return 1;
+	return 0;
+}
+
+intptr_t dupliquer_element( const Ensemble* ensemble, const intptr_t element ){
+	if( ensemble->copier_element && element ){
+		return ensemble->copier_element( element );
+	}
+	return element;
+}
+
+void detruire_element( const Ensemble* ensemble, intptr_t element ){
+	if( ensemble->supprimer_element && element ){
+		ensemble->supprimer_element( element );
+	}
+}
+
+void reserver_elements( Ensemble * ensemble, size_t nb_elements ){
+	if( nb_elements <= ensemble->capacite ) return;
+	size_t nouvelle = 2*ensemble->capacite;
+	if( nouvelle < nb_elements ) nouvelle = nb_elements;
+	ensemble->elements = (intptr_t*) reallouer_arena(
+		ensemble->arena, ensemble->elements, 
+		ensemble->capacite * sizeof(intptr_t), nouvelle * sizeof(intptr_t)
+	);
+	ensemble->capacite = nouvelle;
+}
+
+/*
+ * Renvoie, par dichotomie, l'indice du premier élément d'un ensemble tableau
+ * qui n'est pas plus petit que 'element'. 
+ * '*trouve' est mis à 1 si cet élément est égal à 'element', à 0 sinon.
+ */
+size_t chercher_dans_tableau(
+	const Ensemble* ensemble, const intptr_t element, int* trouve
+){
+	size_t debut = 0;
+	size_t fin = ensemble->nb_elements;
+	while( debut < fin ){
+		size_t milieu = debut + ( fin - debut ) / 2;
+		if( 
+			comparer_deux_elements( 
+				ensemble, ensemble->elements[milieu], element
+			) < 0
+		){
+			debut = milieu + 1;
+		}else{
+			fin = milieu;
+		}
+	}
+	*trouve = debut < ensemble->nb_elements && comparer_deux_elements(
+		ensemble, ensemble->elements[debut], element
+	) == 0;
+	return debut;
+}
+
+/*
+ * Renvoie vrai si les deux ensembles sont des tableaux triés selon le même 
+ * ordre.
+ */
+int sont_des_tableaux( const Ensemble* ens1, const Ensemble* ens2 ){
+	return ens1->representation == ENSEMBLE_TABLEAU 
+		&& ens2->representation == ENSEMBLE_TABLEAU
+		&& ens1->comparer_element == ens2->comparer_element;
+}
+
+/*
+ * Fusionne les 'n' éléments triés de 'source' dans un ensemble tableau. 
+ * Les éléments de 'source' qui ne sont pas déjà dans l'ensemble y sont copiés.
+ */
+void fusionner_dans_tableau(
+	Ensemble * ensemble, const intptr_t* source, size_t n
+){
+	if( n == 0 ) return;
+	size_t capacite = ensemble->nb_elements + n;
+	intptr_t* res = (intptr_t*) allouer_arena( 
+		ensemble->arena, capacite * sizeof(intptr_t) 
+	);
+	size_t i = 0, j = 0, k = 0;
+	while( i < ensemble->nb_elements && j < n ){
+		int cmp = comparer_deux_elements(
+			ensemble, ensemble->elements[i], source[j]
+		);
+		if( cmp < 0 ){
+			res[k++] = ensemble->elements[i++];
+		}else if( cmp > 0 ){
+			res[k] = dupliquer_element( ensemble, source[j++] );
+			compter_ajout( ensemble, res[k++] );
+		}else{
+			res[k++] = ensemble->elements[i++];
+			j++;
+		}
+	}
+	while( i < ensemble->nb_elements ){
+		res[k++] = ensemble->elements[i++];
+	}
+	while( j < n ){
+		res[k] = dupliquer_element( ensemble, source[j++] );
+		compter_ajout( ensemble, res[k++] );
+	}
+	rendre_arena( ensemble->arena, ensemble->elements );
+	ensemble->elements = res;
+	ensemble->nb_elements = k;
+	ensemble->capacite = capacite;
+}
+
+int comparer_tableaux( const Ensemble* ens1, const Ensemble* ens2 ){
+	size_t i;
+	for( i=0; i<ens1->nb_elements && i<ens2->nb_elements; i++ ){
+		int cmp = comparer_deux_elements(
+			ens1, ens1->elements[i], ens2->elements[i]
+		);
+	 	if( cmp > 0 ) return 1;
+	 	if( cmp < 0 ) return -1;
+	}
+	if( ens1->nb_elements == ens2->nb_elements ) return 0;
+	return ( ens1->nb_elements < ens2->nb_elements ) ? -1 : 1;
 }
 
 int comparer_ensemble( const Ensemble* ens1, const Ensemble*  ens2 ){
-	Table_iterateur it1, it2;
+	Ensemble_iterateur it1, it2;
+
+	if( sont_des_bitsets( ens1, ens2 ) ){
+		return comparer_bitsets( ens1, ens2 );
+	}
+	if( sont_des_tableaux( ens1, ens2 ) ){
+		return comparer_tableaux( ens1, ens2 );
+	}
+	if( ens1->cardinal == 0 || ens2->cardinal == 0 ){
+		return ( ens1->cardinal != 0 ) - ( ens2->cardinal != 0 );
+	}
 	
-	it1 = premier_iterateur_table( ens1->table );
-	it2 = premier_iterateur_table( ens2->table );
 	for( 
-		;
-		( ! iterateur_est_vide(it1) ) && ( ! iterateur_est_vide(it2) );
-		next_iterators( &it1, &it2 )
+		it1 = premier_iterateur_ensemble( ens1 ),
+		it2 = premier_iterateur_ensemble( ens2 );
+		( ! iterateur_ensemble_est_vide(it1) ) && 
+		( ! iterateur_ensemble_est_vide(it2) );
+		it1 = iterateur_suivant_ensemble( it1 ),
+		it2 = iterateur_suivant_ensemble( it2 )
 	){
 		int cmp;
 		if( ens1->comparer_element ){
-			cmp = ens1->comparer_element( get_cle( it1 ), get_cle( it2 ) );
+			cmp = ens1->comparer_element( get_element( it1 ), get_element( it2 ) );
 		}else{
-			cmp = get_cle( it1 ) -  get_cle( it2 );
+			cmp = get_element( it1 ) -  get_element( it2 );
 		}
 	 	if( cmp > 0 ) return 1;
 	 	if( cmp < 0 ) return -1;
 	}
-	if( iterateur_est_vide(it1) && iterateur_est_vide(it2) )
+	if( iterateur_ensemble_est_vide(it1) && iterateur_ensemble_est_vide(it2) )
 		return 0;
-	if( iterateur_est_vide(it1) ) 
+	if( iterateur_ensemble_est_vide(it1) ) 
 		return -1;
 	return 1;
 }
 
 
-Ensemble * creer_ensemble(
+Ensemble * allouer_ensemble(
+	Arena* arena,
+	Representation_ensemble representation,
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
 	intptr_t (*copier_element)( const intptr_t elem ),
 	void (*supprimer_element)(intptr_t elem )
 ){
-	Ensemble * result = (Ensemble*) xmalloc( sizeof(Ensemble) );
-	result->table = creer_table(
-		comparer_element, copier_element, supprimer_element
-	);
+	Ensemble * result = (Ensemble*) allouer_arena( arena, sizeof(Ensemble) );
+	result->arena = arena;
+	result->representation = representation;
+	result->table = NULL;
+	result->mots = NULL;
+	result->nb_mots = 0;
+	result->elements = NULL;
+	result->nb_elements = 0;
+	result->capacite = 0;
+	result->cardinal = 0;
+	result->empreinte = 0;
 	result->comparer_element = comparer_element;
 	result->copier_element = copier_element;
 	result->supprimer_element = supprimer_element;
 	return result;
 }
 
+Ensemble * creer_ensemble(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	return creer_ensemble_arena(
+		NULL, ENSEMBLE_AVL, comparer_element, copier_element, supprimer_element
+	);
+}
+
+Ensemble * creer_ensemble_bitset(){
+	return creer_ensemble_arena( NULL, ENSEMBLE_BITSET, NULL, NULL, NULL );
+}
+
+Ensemble * creer_ensemble_tableau(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	return creer_ensemble_arena(
+		NULL, ENSEMBLE_TABLEAU, 
+		comparer_element, copier_element, supprimer_element
+	);
+}
+
+Ensemble * creer_ensemble_arena(
+	Arena* arena,
+	Representation_ensemble representation,
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	Ensemble * result = allouer_ensemble(
+		arena, representation, 
+		comparer_element, copier_element, supprimer_element
+	);
+	if( representation == ENSEMBLE_AVL ){
+		result->table = creer_table_arena(
+			arena, comparer_element, copier_element, supprimer_element
+		);
+	}
+	return result;
+}
+
+Ensemble * creer_ensemble_semblable( const Ensemble* ensemble ){
+	switch( ensemble->representation ){
+		case ENSEMBLE_BITSET:
+			return creer_ensemble_bitset();
+		case ENSEMBLE_TABLEAU:
+			return creer_ensemble_tableau(
+				ensemble->comparer_element, ensemble->copier_element,
+				ensemble->supprimer_element
+			);
+		default:
+			return creer_ensemble(
+				ensemble->comparer_element, ensemble->copier_element,
+				ensemble->supprimer_element
+			);
+	}
+}
+
 void liberer_ensemble( Ensemble * ens ){
 	if(ens){
-		liberer_table( ens->table );
-		xfree( ens );
+		if( ens->table ) liberer_table( ens->table );
+		if( 
+			ens->representation == ENSEMBLE_TABLEAU 
+			&& ( ! ens->arena || ens->supprimer_element )
+		){
+			vider_ensemble( ens );
+		}
+		rendre_arena( ens->arena, ens->mots );
+		rendre_arena( ens->arena, ens->elements );
+		rendre_arena( ens->arena, ens );
 	}
 }
 
 void ajouter_element( Ensemble * ensemble, const intptr_t element ){
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		if( element < 0 ){
+			ERREUR( "Un ensemble bitset ne contient que des entiers positifs" );
+		}
+		if( est_dans_l_ensemble( ensemble, element ) ) return;
+		reserver_mots( ensemble, element / BITS_PAR_MOT + 1 );
+		ensemble->mots[ element / BITS_PAR_MOT ] |= 
+			1ULL << ( element % BITS_PAR_MOT );
+		compter_ajout( ensemble, element );
+		return;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		int trouve;
+		size_t i = chercher_dans_tableau( ensemble, element, &trouve );
+		if( trouve ) return;
+		reserver_elements( ensemble, ensemble->nb_elements + 1 );
+		memmove(
+			ensemble->elements + i + 1, ensemble->elements + i,
+			( ensemble->nb_elements - i ) * sizeof(intptr_t)
+		);
+		ensemble->elements[i] = dupliquer_element( ensemble, element );
+		ensemble->nb_elements++;
+		compter_ajout( ensemble, ensemble->elements[i] );
+		return;
+	}
+	int taille = taille_table( ensemble->table );
 	add_table( ensemble->table, element, (intptr_t) NULL );
+	if( taille_table( ensemble->table ) != taille ){
+		compter_ajout( ensemble, element );
+	}
 }
 
 
@@ -102,12 +469,80 @@ void action_ajouter_element( const intptr_t element, void* ens ){
 	ajouter_element( (Ensemble*) ens, element );
 }
 
+typedef struct {
+	intptr_t* elements;
+	size_t nb_elements;
+	size_t capacite;
+} data_collecter_elements_t;
+
+void action_collecter_element( const intptr_t element, void* data ){
+	data_collecter_elements_t* d = (data_collecter_elements_t*) data;
+	if( d->nb_elements == d->capacite ){
+		d->capacite = d->capacite ? 2*d->capacite : 16;
+		d->elements = (intptr_t*) xrealloc(
+			d->elements, d->capacite * sizeof(intptr_t)
+		);
+	}
+	d->elements[ d->nb_elements++ ] = element;
+}
+
 void ajouter_elements( Ensemble * ens1, const Ensemble * ens2 ){
+	if( sont_des_tableaux( ens1, ens2 ) ){
+		fusionner_dans_tableau( ens1, ens2->elements, ens2->nb_elements );
+		return;
+	}
+	if( 
+		ens1->representation == ENSEMBLE_TABLEAU 
+		&& ens1->comparer_element == ens2->comparer_element
+	){
+		// ens2 est parcouru dans l'ordre de ens1 : on peut fusionner.
+		data_collecter_elements_t data = { NULL, 0, 0 };
+		pour_tout_element( ens2, action_collecter_element, &data );
+		fusionner_dans_tableau( ens1, data.elements, data.nb_elements );
+		xfree( data.elements );
+		return;
+	}
+	if( sont_des_bitsets( ens1, ens2 ) ){
+		size_t i;
+		reserver_mots( ens1, ens2->nb_mots );
+		for( i=0; i<ens2->nb_mots; i++ ){
+			compter_mot( 
+				ens1, ens2->mots[i] & ~ens1->mots[i], i * BITS_PAR_MOT, 1
+			);
+			ens1->mots[i] |= ens2->mots[i];
+		}
+		return;
+	}
 	pour_tout_element( ens2, action_ajouter_element, ens1 );
 }
 
 void retirer_element( Ensemble * ensemble, const intptr_t element ){
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		if( est_dans_l_ensemble( ensemble, element ) ){
+			ensemble->mots[ element / BITS_PAR_MOT ] &= 
+				~( 1ULL << ( element % BITS_PAR_MOT ) );
+			compter_retrait( ensemble, element );
+		}
+		return;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		int trouve;
+		size_t i = chercher_dans_tableau( ensemble, element, &trouve );
+		if( ! trouve ) return;
+		compter_retrait( ensemble, ensemble->elements[i] );
+		detruire_element( ensemble, ensemble->elements[i] );
+		memmove(
+			ensemble->elements + i, ensemble->elements + i + 1,
+			( ensemble->nb_elements - i - 1 ) * sizeof(intptr_t)
+		);
+		ensemble->nb_elements--;
+		return;
+	}
+	int taille = taille_table( ensemble->table );
 	delete_table( ensemble->table, element );
+	if( taille_table( ensemble->table ) != taille ){
+		compter_retrait( ensemble, element );
+	}
 }
 
 void action_retirer_elements( const intptr_t element, void* ens ){
@@ -115,26 +550,114 @@ void action_retirer_elements( const intptr_t element, void* ens ){
 }
 
 void retirer_elements( Ensemble * ens1, const Ensemble * ens2 ){
+	if( sont_des_tableaux( ens1, ens2 ) ){
+		size_t i = 0, j = 0, k = 0;
+		while( i < ens1->nb_elements ){
+			int cmp = ( j < ens2->nb_elements ) ? comparer_deux_elements(
+				ens1, ens1->elements[i], ens2->elements[j]
+			) : -1;
+			if( cmp < 0 ){
+				ens1->elements[k++] = ens1->elements[i++];
+			}else if( cmp > 0 ){
+				j++;
+			}else{
+				compter_retrait( ens1, ens1->elements[i] );
+				detruire_element( ens1, ens1->elements[i++] );
+				j++;
+			}
+		}
+		ens1->nb_elements = k;
+		return;
+	}
+	if( sont_des_bitsets( ens1, ens2 ) ){
+		size_t i;
+		size_t n = ens1->nb_mots < ens2->nb_mots ? ens1->nb_mots : ens2->nb_mots;
+		for( i=0; i<n; i++ ){
+			compter_mot( 
+				ens1, ens1->mots[i] & ens2->mots[i], i * BITS_PAR_MOT, 0
+			);
+			ens1->mots[i] &= ~ens2->mots[i];
+		}
+		return;
+	}
 	pour_tout_element( ens2, action_retirer_elements, ens1 );
 }
 
 void vider_ensemble( Ensemble * ensemble ){
+	ensemble->cardinal = 0;
+	ensemble->empreinte = 0;
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		if( ensemble->nb_mots ){
+			memset( ensemble->mots, 0, ensemble->nb_mots * sizeof(uint64_t) );
+		}
+		return;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		size_t i;
+		for( i=0; i<ensemble->nb_elements; i++ ){
+			detruire_element( ensemble, ensemble->elements[i] );
+		}
+		ensemble->nb_elements = 0;
+		return;
+	}
 	vider_table( ensemble->table );
 }
 
 int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		return element >= 0 && element / BITS_PAR_MOT < ensemble->nb_mots 
+			&& ( ensemble->mots[ element / BITS_PAR_MOT ] 
+				>> ( element % BITS_PAR_MOT ) ) & 1;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		int trouve;
+		chercher_dans_tableau( ensemble, element, &trouve );
+		return trouve;
+	}
 	Table_iterateur it = trouver_table( ensemble->table, element );
-	return ! avl_t_is_null( &it ); 
+	return ! iterateur_est_vide( it ); 
 }
 
-void action_taille_ensemble( const intptr_t element, void* taille ){
-	(*(int*) taille)+=1;
+unsigned int taille_ensemble( const Ensemble* ensemble ){
+	return ensemble->cardinal;
 }
 
-unsigned int taille_ensemble( const Ensemble* ensemble ){
-	int taille = 0;
-	pour_tout_element( ensemble, action_taille_ensemble, &taille );
-	return taille;
+uint64_t empreinte_ensemble( const Ensemble* ensemble ){
+	return ensemble->empreinte;
+}
+
+/*
+ * Renvoie vrai si les empreintes des deux ensembles sont comparables, 
+ * c'est-à-dire si ce sont des ensembles d'entiers.
+ */
+int empreintes_comparables( const Ensemble* ens1, const Ensemble* ens2 ){
+	return ! ens1->comparer_element && ! ens2->comparer_element;
+}
+
+int ensembles_egaux( const Ensemble* ens1, const Ensemble* ens2 ){
+	if( ens1->cardinal != ens2->cardinal ) return 0;
+	if( 
+		empreintes_comparables( ens1, ens2 ) 
+		&& ens1->empreinte != ens2->empreinte
+	){
+		return 0;
+	}
+	return comparer_ensemble( ens1, ens2 ) == 0;
+}
+
+int comparer_ensemble_par_empreinte( 
+	const Ensemble* ens1, const Ensemble* ens2 
+){
+	if( ens1->cardinal != ens2->cardinal ){
+		return ( ens1->cardinal < ens2->cardinal ) ? -1 : 1;
+	}
+	if( 
+		empreintes_comparables( ens1, ens2 ) 
+		&& ens1->empreinte != ens2->empreinte
+	){
+		return ( ens1->empreinte < ens2->empreinte ) ? -1 : 1;
+	}
+	return comparer_ensemble( ens1, ens2 );
 }
 
 typedef struct {
@@ -179,6 +702,24 @@ void pour_tout_element(
 	void (* action )( const intptr_t element, void* data ),
 	void* data
 ){
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		size_t i;
+		for( i=0; i<ensemble->nb_mots; i++ ){
+			uint64_t mot = ensemble->mots[i];
+			while( mot ){
+				action( i * BITS_PAR_MOT + __builtin_ctzll( mot ), data );
+				mot &= mot - 1;
+			}
+		}
+		return;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		size_t i;
+		for( i=0; i<ensemble->nb_elements; i++ ){
+			action( ensemble->elements[i], data );
+		}
+		return;
+	}
 	data_pour_tout_element_t data1;
 	data1.action = action;
 	data1.data = data;
@@ -188,9 +729,10 @@ void pour_tout_element(
 }
 
 void swap_ensemble( Ensemble* ens1, Ensemble* ens2 ){
-	void* tmp = ens1->table;
-	ens1->table = ens2->table;
-	ens2->table = tmp;
+	assert( ens1->arena == ens2->arena );
+	Ensemble tmp = *ens1;
+	*ens1 = *ens2;
+	*ens2 = tmp;
 }
 void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	swap_ensemble( ens1, ens2 );
@@ -198,10 +740,29 @@ void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 }
 
 Ensemble* copier_ensemble( const Ensemble* ensemble ){
-	Ensemble* res = creer_ensemble(
-		ensemble->comparer_element, ensemble->copier_element,
-		ensemble->supprimer_element
-	);
+	Ensemble* res = creer_ensemble_semblable( ensemble );
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		reserver_mots( res, ensemble->nb_mots );
+		if( ensemble->nb_mots ){
+			memcpy(
+				res->mots, ensemble->mots, ensemble->nb_mots * sizeof(uint64_t)
+			);
+		}
+		res->cardinal = ensemble->cardinal;
+		res->empreinte = ensemble->empreinte;
+		return res;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		size_t i;
+		reserver_elements( res, ensemble->nb_elements );
+		for( i=0; i<ensemble->nb_elements; i++ ){
+			res->elements[i] = dupliquer_element( ensemble, ensemble->elements[i] );
+		}
+		res->nb_elements = ensemble->nb_elements;
+		res->cardinal = ensemble->cardinal;
+		res->empreinte = ensemble->empreinte;
+		return res;
+	}
 	ajouter_elements( res, ensemble  );
 	return res;
 }
@@ -223,37 +784,152 @@ Ensemble * creer_difference_ensemble(
 Ensemble * creer_intersection_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 ){
-	Ensemble *tmp, *res;
-	tmp = creer_difference_ensemble( ens1, ens2 );
-	res = creer_difference_ensemble( ens1, tmp );
-	liberer_ensemble( tmp );
+	Ensemble *res;
+	if( sont_des_bitsets( ens1, ens2 ) ){
+		size_t i;
+		res = copier_ensemble( ens1 );
+		for( i=0; i<res->nb_mots; i++ ){
+			uint64_t mot = ( i < ens2->nb_mots ) ? ens2->mots[i] : 0;
+			compter_mot( res, res->mots[i] & ~mot, i * BITS_PAR_MOT, 0 );
+			res->mots[i] &= mot;
+		}
+		return res;
+	}
+	res = creer_ensemble_semblable( ens1 );
+	if( sont_des_tableaux( ens1, ens2 ) ){
+		size_t i = 0, j = 0;
+		reserver_elements(
+			res, ens1->nb_elements < ens2->nb_elements ? 
+				ens1->nb_elements : ens2->nb_elements
+		);
+		while( i < ens1->nb_elements && j < ens2->nb_elements ){
+			int cmp = comparer_deux_elements(
+				ens1, ens1->elements[i], ens2->elements[j]
+			);
+			if( cmp < 0 ){
+				i++;
+			}else if( cmp > 0 ){
+				j++;
+			}else{
+				res->elements[ res->nb_elements ] = 
+					dupliquer_element( ens1, ens1->elements[i] );
+				compter_ajout( res, res->elements[ res->nb_elements++ ] );
+				i++;
+				j++;
+			}
+		}
+		return res;
+	}
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( ens1 );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		if( est_dans_l_ensemble( ens2, get_element( it ) ) ){
+			ajouter_element( res, get_element( it ) );
+		}
+	}
 	return res;
 }
 
 Ensemble_iterateur trouver_ensemble(
 	const Ensemble* ensemble, const intptr_t element
 ){
-	return trouver_table( ensemble->table, element );
+	Ensemble_iterateur it;
+	it.ensemble = ensemble;
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		it.position = est_dans_l_ensemble( ensemble, element ) ? element : -1;
+		return it;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		int trouve;
+		size_t i = chercher_dans_tableau( ensemble, element, &trouve );
+		it.position = trouve ? i : -1;
+		return it;
+	}
+	it.it = trouver_table( ensemble->table, element );
+	return it;
 }
 
 Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble ){
-	return premier_iterateur_table( ensemble->table );
+	Ensemble_iterateur it;
+	it.ensemble = ensemble;
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		it.position = element_bitset_suivant( ensemble, 0 );
+		return it;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		it.position = ensemble->nb_elements ? 0 : -1;
+		return it;
+	}
+	it.it = premier_iterateur_table( ensemble->table );
+	return it;
+}
+
+Ensemble_iterateur dernier_iterateur_ensemble( const Ensemble* ensemble ){
+	Ensemble_iterateur it;
+	it.ensemble = ensemble;
+	if( ensemble->representation == ENSEMBLE_BITSET ){
+		it.position = element_bitset_precedent( 
+			ensemble, (intptr_t) ensemble->nb_mots * BITS_PAR_MOT - 1 
+		);
+		return it;
+	}
+	if( ensemble->representation == ENSEMBLE_TABLEAU ){
+		it.position = (intptr_t) ensemble->nb_elements - 1;
+		return it;
+	}
+	it.it = dernier_iterateur_table( NULL, ensemble->table );
+	return it;
 }
 
 Ensemble_iterateur iterateur_suivant_ensemble(
 	const Ensemble_iterateur iterateur
 ){
-	return iterateur_suivant_table( iterateur );
+	Ensemble_iterateur it = iterateur;
+	if( it.ensemble->representation == ENSEMBLE_BITSET ){
+		it.position = element_bitset_suivant( it.ensemble, it.position + 1 );
+		return it;
+	}
+	if( it.ensemble->representation == ENSEMBLE_TABLEAU ){
+		it.position++;
+		if( it.position >= (intptr_t) it.ensemble->nb_elements ){
+			it.position = -1;
+		}
+		return it;
+	}
+	it.it = iterateur_suivant_table( it.it );
+	return it;
 }
 
 Ensemble_iterateur iterateur_precedent_ensemble( Ensemble_iterateur iterateur ){
-	return iterateur_precedent_table( iterateur );
+	Ensemble_iterateur it = iterateur;
+	if( it.ensemble->representation == ENSEMBLE_BITSET ){
+		it.position = element_bitset_precedent( it.ensemble, it.position - 1 );
+		return it;
+	}
+	if( it.ensemble->representation == ENSEMBLE_TABLEAU ){
+		it.position--;
+		return it;
+	}
+	it.it = iterateur_precedent_table( it.it );
+	return it;
 }
 
 int iterateur_ensemble_est_vide( Ensemble_iterateur iterateur ){
-	return iterateur_est_vide( iterateur );
+	if( iterateur.ensemble->representation != ENSEMBLE_AVL ){
+		return iterateur.position < 0;
+	}
+	return iterateur_est_vide( iterateur.it );
 }
 
 intptr_t get_element( Ensemble_iterateur it ){
-	return get_cle( it );
+	if( it.ensemble->representation == ENSEMBLE_BITSET ){
+		return it.position;
+	}
+	if( it.ensemble->representation == ENSEMBLE_TABLEAU ){
+		return it.ensemble->elements[ it.position ];
+	}
+	return get_cle( it.it );
 }
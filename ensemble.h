@@ -27,14 +27,46 @@
 #include "avl.h"
 #include "table.h"
 
+/*
+ * Définit les différentes représentations possibles d'un ensemble.
+ *
+ *   - ENSEMBLE_AVL : les éléments sont rangés dans un arbre AVL (via une 
+ *     Table). C'est la représentation par défaut, qui accepte n'importe quel
+ *     élément (entiers ou pointeurs vers des structures plus complexes).
+ *   - ENSEMBLE_BITSET : l'ensemble est un tableau de bits, le bit i valant 1
+ *     si l'entier i est dans l'ensemble. Cette représentation ne peut contenir
+ *     que des entiers positifs ou nuls, et de préférence petits (comme des 
+ *     numéros d'états). Les opérations ensemblistes (union, différence,
+ *     intersection, comparaison) se font alors mot machine par mot machine.
+ *   - ENSEMBLE_TABLEAU : les éléments sont rangés dans un tableau contigu trié.
+ *     La recherche se fait par dichotomie et les opérations ensemblistes par 
+ *     fusion linéaire des tableaux. L'ajout d'un élément isolé coûte un 
+ *     décalage du tableau : cette représentation convient aux ensembles 
+ *     construits une fois puis beaucoup lus.
+ */
+typedef enum {
+	ENSEMBLE_AVL,
+	ENSEMBLE_BITSET,
+	ENSEMBLE_TABLEAU
+} Representation_ensemble;
+
 /*
  * Définit le type d'un ensemble.
  */
 struct Ensemble {
-	Table* table;
+	Representation_ensemble representation;
+	Table* table;           /* Représentation ENSEMBLE_AVL */
+	uint64_t* mots;         /* Représentation ENSEMBLE_BITSET */
+	size_t nb_mots;
+	intptr_t* elements;     /* Représentation ENSEMBLE_TABLEAU */
+	size_t nb_elements;
+	size_t capacite;
+	unsigned int cardinal;  /* Nombre d'éléments, tenu à jour à chaque ajout */
+	uint64_t empreinte;     /* Ou exclusif des empreintes des éléments */
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 );
 	intptr_t (*copier_element)( const intptr_t elem );
 	void (*supprimer_element)(intptr_t elem );
+	Arena* arena;           /* NULL si l'ensemble est alloué par xmalloc() */
 };
 
 typedef struct Ensemble Ensemble;
@@ -42,7 +74,12 @@ typedef struct Ensemble Ensemble;
 /*
  * Définit le type d'un itérateur sur les éléments d'un ensemble.
  */
-typedef struct avl_traverser Ensemble_iterateur;
+typedef struct {
+	const Ensemble* ensemble;
+	Table_iterateur it;     /* Représentation ENSEMBLE_AVL */
+	intptr_t position;      /* ENSEMBLE_BITSET : l'élément courant,
+	                           ENSEMBLE_TABLEAU : son indice, -1 si vide */
+} Ensemble_iterateur;
 
 /*
  * Renvoie un nouvel ensemble vide.
@@ -64,6 +101,51 @@ Ensemble * creer_ensemble(
 	void (*supprimer_element)( intptr_t elem )
 );
 
+/*
+ * Renvoie un nouvel ensemble vide représenté par un tableau de bits.
+ *
+ * Un tel ensemble ne peut contenir que des entiers positifs ou nuls. 
+ * Son occupation mémoire est proportionnelle au plus grand élément qui y a été
+ * ajouté.
+ */
+Ensemble * creer_ensemble_bitset();
+
+/*
+ * Renvoie un nouvel ensemble vide représenté par un tableau trié.
+ *
+ * Les paramètres ont le même sens que pour creer_ensemble().
+ */
+Ensemble * creer_ensemble_tableau(
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)( intptr_t elem )
+);
+
+/*
+ * Renvoie un nouvel ensemble vide de la représentation donnée, dont toute la
+ * mémoire est prise dans l'arène 'arena'.
+ *
+ * Les autres paramètres ont le même sens que pour creer_ensemble() (ils sont
+ * ignorés pour ENSEMBLE_BITSET). Si 'supprimer_element' est NULL, 
+ * liberer_ensemble() n'a rien à parcourir : l'ensemble disparaît avec 
+ * l'arène.
+ */
+Ensemble * creer_ensemble_arena(
+	Arena* arena,
+	Representation_ensemble representation,
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)( intptr_t elem )
+);
+
+/*
+ * Renvoie un nouvel ensemble vide, ayant la même représentation et les mêmes
+ * fonctions de gestion des éléments que l'ensemble passé en paramètre.
+ * Le nouvel ensemble est alloué par xmalloc(), même si l'ensemble passé en
+ * paramètre est dans une arène.
+ */
+Ensemble * creer_ensemble_semblable( const Ensemble* ensemble );
+
 /*
  * Libère la mémoire d'un ensemble.
  * La mémoire de tous les éléments de l'ensemble est aussi libérée.
@@ -82,6 +164,9 @@ void ajouter_element( Ensemble * ensemble, const intptr_t  element );
 
 /*
  * Ajoute tous les éléments d'un ensemble à un ensemble.
+ *
+ * Si le premier ensemble est un tableau trié, les éléments sont ajoutés en une
+ * seule fusion plutôt qu'un par un.
  */
 void ajouter_elements( Ensemble * ens1, const Ensemble * ens2 );
 
@@ -113,9 +198,29 @@ int est_dans_l_ensemble( const Ensemble * ensemble, const intptr_t element );
 
 /*
  * Renvoie le nombre d'éléments qui se trouvent dans l'ensemble.
+ * Le calcul se fait en temps constant.
  */
 unsigned int taille_ensemble( const Ensemble* ensemble );
 
+/*
+ * Renvoie l'empreinte de l'ensemble : le ou exclusif des empreintes de ses 
+ * éléments. Elle ne dépend donc pas de l'ordre des éléments, et elle est tenue
+ * à jour à chaque ajout ou retrait d'un élément.
+ *
+ * L'empreinte d'un élément est calculée à partir de sa valeur entière : elle
+ * n'a de sens que pour les ensembles d'entiers, c'est-à-dire créés sans 
+ * fonction de comparaison.
+ */
+uint64_t empreinte_ensemble( const Ensemble* ensemble );
+
+/*
+ * Renvoie 1 si les deux ensembles ont les mêmes éléments, 0 sinon.
+ *
+ * Les ensembles de tailles ou d'empreintes différentes sont rejetés sans 
+ * parcourir leurs éléments.
+ */
+int ensembles_egaux( const Ensemble* ens1, const Ensemble* ens2 );
+
 /*
  * Compare deux ensembles entre eux.
  *
@@ -128,6 +233,17 @@ unsigned int taille_ensemble( const Ensemble* ensemble );
  */
 int comparer_ensemble( const Ensemble* ens1, const Ensemble*  ens2 );
 
+/*
+ * Compare deux ensembles entre eux, en ordonnant d'abord les ensembles par 
+ * taille, puis par empreinte, puis par ordre lexicographique.
+ *
+ * Cette fonction renvoie 0 si et seulement si les ensembles sont identiques.
+ * L'ordre obtenu n'est pas l'ordre lexicographique, mais il est total : on 
+ * peut donc l'utiliser pour ranger des ensembles dans une table, où la plupart
+ * des comparaisons se réduisent alors à une comparaison d'entiers.
+ */
+int comparer_ensemble_par_empreinte( const Ensemble* ens1, const Ensemble* ens2 );
+
 /*
  * Renvoie une copie de l'ensemble passé en paramètre
  */
@@ -174,6 +290,8 @@ void print_ensemble(
 
 /*
  * Échange le contenu de deux ensembles passés en paramètre.
+ * Les deux ensembles doivent être alloués dans la même arène (ou tous les 
+ * deux par xmalloc()).
  */
 void swap_ensemble( Ensemble* ens1, Ensemble* ens2 );
 
@@ -198,6 +316,11 @@ Ensemble_iterateur trouver_ensemble(
  */
 Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble );
 
+/*
+ * Renvoie un itérateur positionné sur le dernier élement de l'ensemble.
+ */
+Ensemble_iterateur dernier_iterateur_ensemble( const Ensemble* ensemble );
+
 /*
  * Renvoie l'iterateur suivant.
  *
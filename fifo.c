@@ -22,62 +22,103 @@
 #include "outils.h"
 #include "fifo.h"
 
-typedef struct List List;
+#include <assert.h>
+#include <string.h>
 
-struct List {
-	List * next;
-	intptr_t element;
-};
+#define CAPACITE_INITIALE 16
 
+/*
+ * Les éléments occupent les cases debut, debut+1, ..., debut+taille-1 
+ * (modulo la capacité, qui est une puissance de 2).
+ */
 struct Fifo {
-	List * list;
+	intptr_t * elements;
+	size_t capacite;
+	size_t debut;
+	size_t taille;
 };
 
-List* allouer_list( List * next, intptr_t element ){
-	List* res = (List*) xmalloc( sizeof(List) );
-	res->next = next;
-	res->element = element;
-	return res;
+size_t case_fifo( const Fifo* fifo, size_t i ){
+	return ( fifo->debut + i ) & ( fifo->capacite - 1 );
 }
 
-void liberer_list( List * list ){
-	xfree( list );
+/*
+ * Double la capacité de la file. Les éléments sont recopiés dans l'ordre au
+ * début du nouveau tableau.
+ */
+void agrandir_fifo( Fifo* fifo ){
+	size_t capacite = 2 * fifo->capacite;
+	intptr_t * elements = (intptr_t*) xmalloc( capacite * sizeof(intptr_t) );
+	size_t premiers = fifo->capacite - fifo->debut;
+	if( premiers > fifo->taille ) premiers = fifo->taille;
+	memcpy( 
+		elements, fifo->elements + fifo->debut, premiers * sizeof(intptr_t) 
+	);
+	memcpy( 
+		elements + premiers, fifo->elements, 
+		( fifo->taille - premiers ) * sizeof(intptr_t) 
+	);
+	xfree( fifo->elements );
+	fifo->elements = elements;
+	fifo->capacite = capacite;
+	fifo->debut = 0;
 }
 
 void ajouter_fifo( Fifo* fifo, intptr_t element ){
-	fifo->list = allouer_list( fifo->list, element );
+	if( fifo->taille == fifo->capacite ) agrandir_fifo( fifo );
+	fifo->elements[ case_fifo( fifo, fifo->taille ) ] = element;
+	fifo->taille++;
+}
+
+void ajouter_debut_fifo( Fifo* fifo, intptr_t element ){
+	if( fifo->taille == fifo->capacite ) agrandir_fifo( fifo );
+	fifo->debut = case_fifo( fifo, fifo->capacite - 1 );
+	fifo->elements[ fifo->debut ] = element;
+	fifo->taille++;
 }
 
 intptr_t retirer_fifo( Fifo* fifo ){
-	intptr_t res = fifo->list->element;
-	List* tmp = fifo->list;
-	fifo->list = fifo->list->next;
-	liberer_list( tmp );
+	assert( fifo->taille );
+	intptr_t res = fifo->elements[ fifo->debut ];
+	fifo->debut = case_fifo( fifo, 1 );
+	fifo->taille--;
 	return res;
 }
 
+intptr_t retirer_fin_fifo( Fifo* fifo ){
+	assert( fifo->taille );
+	fifo->taille--;
+	return fifo->elements[ case_fifo( fifo, fifo->taille ) ];
+}
+
 intptr_t obtenir_fifo( Fifo* fifo ){
-	return fifo->list->element;
+	assert( fifo->taille );
+	return fifo->elements[ fifo->debut ];
+}
+
+intptr_t obtenir_fin_fifo( Fifo* fifo ){
+	assert( fifo->taille );
+	return fifo->elements[ case_fifo( fifo, fifo->taille - 1 ) ];
 }
 
 int est_vide( Fifo* fifo ){
-	return fifo->list == NULL;
+	return fifo->taille == 0;
+}
+
+size_t taille_fifo( const Fifo* fifo ){
+	return fifo->taille;
 }
 
 Fifo* creer_fifo(){
 	Fifo* res = xmalloc( sizeof(Fifo) );
-	res->list = NULL;
+	res->capacite = CAPACITE_INITIALE;
+	res->elements = (intptr_t*) xmalloc( res->capacite * sizeof(intptr_t) );
+	res->debut = 0;
+	res->taille = 0;
 	return res;
 }
 
-void vider_list( List * list ){
-	if( list ){
-		vider_list( list->next );
-		xfree( list );
-	}
-}
-
 void liberer_fifo( Fifo* file ){
-	vider_list( file->list );
+	xfree( file->elements );
 	xfree( file );
 }
@@ -22,6 +22,7 @@
 #ifndef __FIFO_H__
 #define __FIFO_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*
@@ -29,6 +30,11 @@
  * des pointerus vers des stucture plus complexes.
  * La file n'est pas responsable de la mémoire des éléments qui y sont 
  * entreposés.
+ *
+ * La file est rangée dans un tableau circulaire qui grandit au besoin : 
+ * ajouter ou retirer un élément, à l'une ou l'autre des extrémités, se fait
+ * en temps constant amorti et sans allocation par élément. La file peut donc
+ * aussi servir de pile ou de file à double entrée.
  */
 typedef struct Fifo Fifo;
 
@@ -49,19 +55,43 @@ void liberer_fifo( Fifo* fifo );
 int est_vide( Fifo* fifo );
 
 /*
- * Ajoute un élément au dessus de la pile.
+ * Renvoie le nombre d'éléments de la file.
+ */
+size_t taille_fifo( const Fifo* fifo );
+
+/*
+ * Ajoute un élément à la fin de la file.
  */
 void ajouter_fifo( Fifo* fifo, intptr_t element );
 
 /*
- * Retire un élément du dessus de la pile et le renvoie.
+ * Retire l'élément du début de la file (le plus ancien) et le renvoie.
+ * La file ne doit pas être vide.
  */
 intptr_t retirer_fifo( Fifo* fifo );
 
 /*
- * Renvoie l'élement qui se trouve au dessus de la pile. L'élément n'est pas
- * retiré de la pile.
+ * Renvoie l'élement qui se trouve au début de la file. L'élément n'est pas
+ * retiré de la file.
  */
 intptr_t obtenir_fifo( Fifo* fifo );
 
+/*
+ * Ajoute un élément au début de la file : ce sera le prochain élément 
+ * renvoyé par retirer_fifo().
+ */
+void ajouter_debut_fifo( Fifo* fifo, intptr_t element );
+
+/*
+ * Retire l'élément de la fin de la file (le plus récent) et le renvoie.
+ * Avec ajouter_fifo(), cela permet d'utiliser la file comme une pile.
+ * La file ne doit pas être vide.
+ */
+intptr_t retirer_fin_fifo( Fifo* fifo );
+
+/*
+ * Renvoie l'élement qui se trouve à la fin de la file, sans le retirer.
+ */
+intptr_t obtenir_fin_fifo( Fifo* fifo );
+
 #endif
@@ -0,0 +1,108 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "lignes.h"
+#include "table.h"
+#include "outils.h"
+
+#include <string.h>
+
+void initialiser_lignes( Lignes * lignes, int largeur ){
+    lignes->largeur = largeur;
+    lignes->nb = 0;
+    lignes->capacite = 16;
+    lignes->lignes = xmalloc( 
+        (size_t) lignes->capacite * largeur * sizeof(uint64_t) 
+    );
+    lignes->masque = 31;
+    lignes->alveoles = xmalloc( ( lignes->masque + 1 ) * sizeof(int) );
+    memset( lignes->alveoles, -1, ( lignes->masque + 1 ) * sizeof(int) );
+}
+
+void liberer_lignes( Lignes * lignes ){
+    xfree( lignes->lignes );
+    xfree( lignes->alveoles );
+}
+
+const uint64_t * lire_ligne( const Lignes * lignes, int numero ){
+    return lignes->lignes + (size_t) numero * lignes->largeur;
+}
+
+uint64_t hacher_ligne( const uint64_t * ligne, int largeur ){
+    uint64_t h = 0;
+    int w;
+    for( w=0; w<largeur; w++ ){
+        h = hacher_entier( h ^ ligne[w] );
+    }
+    return h;
+}
+
+/*
+ * Renvoie la case de la table où se trouve la ligne, ou la case vide où il 
+ * faut la ranger.
+ */
+int alveole_ligne( const Lignes * lignes, const uint64_t * l ){
+    size_t taille = lignes->largeur * sizeof(uint64_t);
+    int a = hacher_ligne( l, lignes->largeur ) & lignes->masque;
+    while( 
+        lignes->alveoles[a] >= 0 
+        && memcmp( lire_ligne( lignes, lignes->alveoles[a] ), l, taille ) 
+    ){
+        a = ( a + 1 ) & lignes->masque;
+    }
+    return a;
+}
+
+int interner_ligne( Lignes * lignes, const uint64_t * l ){
+    int a = alveole_ligne( lignes, l );
+    if( lignes->alveoles[a] >= 0 ) return lignes->alveoles[a];
+
+    if( lignes->nb == lignes->capacite ){
+        lignes->capacite *= 2;
+        lignes->lignes = xrealloc( 
+            lignes->lignes, 
+            (size_t) lignes->capacite * lignes->largeur * sizeof(uint64_t) 
+        );
+    }
+    int numero = lignes->nb++;
+    memcpy( 
+        lignes->lignes + (size_t) numero * lignes->largeur, l, 
+        lignes->largeur * sizeof(uint64_t) 
+    );
+    lignes->alveoles[a] = numero;
+
+    if( 2 * lignes->nb > lignes->masque ){
+        // On double la table et on y range de nouveau toutes les lignes.
+        lignes->masque = 2 * lignes->masque + 1;
+        lignes->alveoles = xrealloc( 
+            lignes->alveoles, ( lignes->masque + 1 ) * sizeof(int) 
+        );
+        memset( lignes->alveoles, -1, ( lignes->masque + 1 ) * sizeof(int) );
+        int i;
+        for( i=0; i<lignes->nb; i++ ){
+            lignes->alveoles[ alveole_ligne( lignes, lire_ligne( lignes, i ) ) ] = i;
+        }
+    }
+    return numero;
+}
+
+int trouver_ligne( const Lignes * lignes, const uint64_t * l ){
+    return lignes->alveoles[ alveole_ligne( lignes, l ) ];
+}
@@ -0,0 +1,80 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file lignes.h */ 
+
+#ifndef __LIGNES_H__
+#define __LIGNES_H__
+
+#include <stdint.h>
+
+/**
+ * @brief Un ensemble de lignes de 'largeur' mots de 64 bits, numérotées de
+ *        0 à nb-1 dans l'ordre où elles sont ajoutées.
+ *
+ * Les lignes sont rangées les unes à la suite des autres dans un seul 
+ * tableau, et retrouvées par une table de hachage à adressage ouvert qui ne
+ * contient que leurs numéros. On s'en sert pour numéroter des ensembles 
+ * d'états codés par des tableaux de bits (déterminisation), ou des 
+ * signatures d'états (minimisation), sans allouer de mémoire par ligne.
+ *
+ * La structure peut être rangée sur la pile ; elle est initialisée par 
+ * initialiser_lignes() et libérée par liberer_lignes().
+ */
+typedef struct Lignes {
+	int largeur;
+	int nb;
+	int capacite;
+	uint64_t * lignes;
+	int * alveoles;     //!< Numéros des lignes, -1 pour une case vide
+	int masque;         //!< Nombre de cases de 'alveoles', moins 1
+} Lignes;
+
+/**
+ * @brief Initialise un ensemble vide de lignes de 'largeur' mots.
+ */
+void initialiser_lignes( Lignes * lignes, int largeur );
+
+/**
+ * @brief Libère la mémoire d'un ensemble de lignes.
+ */
+void liberer_lignes( Lignes * lignes );
+
+/**
+ * @brief Renvoie l'adresse de la ligne de numéro 'numero'.
+ *
+ * L'adresse n'est plus valable après un appel à interner_ligne().
+ */
+const uint64_t * lire_ligne( const Lignes * lignes, int numero );
+
+/**
+ * @brief Renvoie le numéro de la ligne 'ligne', en l'ajoutant si elle n'y 
+ *        est pas encore.
+ *
+ * La ligne est copiée : 'ligne' peut ensuite être modifiée.
+ */
+int interner_ligne( Lignes * lignes, const uint64_t * ligne );
+
+/**
+ * @brief Renvoie le numéro de la ligne 'ligne', ou -1 si elle n'y est pas.
+ */
+int trouver_ligne( const Lignes * lignes, const uint64_t * ligne );
+
+#endif
@@ -39,6 +39,14 @@ void* xmalloc( size_t n ){
 	return result;
 }
 
+void* xrealloc( void* ptr, size_t n ){
+	void* result = realloc( ptr, n );
+	if( ! result && n ){
+		ERREUR( "Espace insuffisant" );
+	}
+	return result;
+}
+
 void xfree( void* ptr ){
 	free(ptr);
 }
@@ -0,0 +1,294 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * grep_automate : affiche les lignes de fichiers qui contiennent un mot du 
+ * langage d'une expression rationnelle.
+ *
+ *     grep_automate [-c] [-s] EXPRESSION [FICHIER...]
+ *
+ *   -c  affiche le nombre de lignes trouvées au lieu des lignes ;
+ *   -s  affiche sur la sortie d'erreur le nombre d'octets lus et le débit.
+ *
+ * L'expression suit la syntaxe de expression_to_rationnel(). Elle est 
+ * compilée par compiler_rationnel_recherche(), qui filtre le texte sur son 
+ * facteur obligatoire, et chaque fichier est lu d'un seul passage par 
+ * rechercher_occurrences(). Les fichiers ordinaires sont projetés en 
+ * mémoire avec mmap() et les lignes sont affichées directement depuis la 
+ * projection ; l'entrée standard (sans FICHIER, ou « - ») et les tubes sont
+ * lus par morceaux.
+ *
+ * Une occurrence ne peut pas contenir de fin de ligne (les expressions ne 
+ * contiennent que des lettres minuscules) : une ligne est trouvée si une 
+ * occurrence finit dans cette ligne.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "automate.h"
+#include "automate_recherche.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TAILLE_MORCEAU ( 1 << 20 )
+
+typedef struct {
+	int compter;
+	int statistiques;
+	const char * prefixe;     //!< Nom du fichier à afficher, ou NULL
+} Options;
+
+/*
+ * L'état de la recherche dans un texte : les lignes trouvées sont affichées
+ * (ou comptées) au fil des occurrences.
+ */
+typedef struct {
+	const Options * options;
+	const uint8_t * texte;
+	size_t taille;
+	size_t fin_derniere_ligne;  //!< Fin de la dernière ligne trouvée
+	size_t nb_lignes;
+} Recherche;
+
+void afficher_ligne( const Recherche * r, size_t debut, size_t fin ){
+	if( r->options->prefixe ) printf( "%s:", r->options->prefixe );
+	fwrite( r->texte + debut, 1, fin - debut, stdout );
+	putchar( '\n' );
+}
+
+/*
+ * Appelée pour chaque occurrence qui finit en 'fin' : trouve sa ligne, et 
+ * l'affiche si ce n'est pas déjà fait.
+ */
+void action_occurrence( size_t fin, void* data ){
+	Recherche * r = (Recherche*) data;
+	if( fin > 0 && fin <= r->fin_derniere_ligne ) return;
+	size_t debut = fin > 0 ? fin - 1 : 0;
+	while( debut > r->fin_derniere_ligne && r->texte[debut-1] != '\n' ){
+		debut--;
+	}
+	const uint8_t * nl = memchr( r->texte + fin, '\n', r->taille - fin );
+	size_t fin_ligne = nl ? (size_t) ( nl - r->texte ) : r->taille;
+	r->fin_derniere_ligne = fin_ligne + 1;
+	r->nb_lignes++;
+	if( ! r->options->compter ) afficher_ligne( r, debut, fin_ligne );
+}
+
+/*
+ * Cherche dans les lignes de 'texte' et renvoie le nombre de lignes 
+ * trouvées. Chaque '\n' termine une ligne, éventuellement vide ; les octets
+ * qui suivent le dernier '\n', s'il y en a, forment une dernière ligne. Si 
+ * le mot vide est reconnu, toutes les lignes le sont.
+ */
+size_t chercher_dans_texte( 
+	const Automate_recherche * automate, int mot_vide, 
+	const uint8_t * texte, size_t taille, const Options * options
+){
+	Recherche r = { options, texte, taille, 0, 0 };
+	if( mot_vide ){
+		size_t debut = 0;
+		while( debut < taille ){
+			const uint8_t * nl = memchr( texte + debut, '\n', taille - debut );
+			size_t fin = nl ? (size_t) ( nl - texte ) : taille;
+			r.nb_lignes++;
+			if( ! options->compter ) afficher_ligne( &r, debut, fin );
+			debut = fin + 1;
+		}
+	}else{
+		rechercher_occurrences( automate, texte, taille, action_occurrence, &r );
+	}
+	return r.nb_lignes;
+}
+
+/*
+ * Lit le fichier 'fd' par morceaux : seules les lignes complètes de chaque 
+ * morceau sont cherchées, la ligne incomplète est reportée au morceau 
+ * suivant.
+ */
+size_t chercher_dans_flux( 
+	const Automate_recherche * automate, int mot_vide, int fd, 
+	const Options * options, size_t * nb_octets
+){
+	size_t capacite = TAILLE_MORCEAU;
+	uint8_t * tampon = xmalloc( capacite );
+	size_t rempli = 0;
+	size_t nb_lignes = 0;
+	for( ;; ){
+		if( rempli == capacite ){
+			capacite *= 2;
+			tampon = xrealloc( tampon, capacite );
+		}
+		ssize_t lus = read( fd, tampon + rempli, capacite - rempli );
+		if( lus < 0 ){
+			perror( "read" );
+			break;
+		}
+		if( lus == 0 ){
+			// La dernière ligne, sans fin de ligne
+			if( rempli > 0 ){
+				nb_lignes += chercher_dans_texte( 
+					automate, mot_vide, tampon, rempli, options 
+				);
+			}
+			break;
+		}
+		*nb_octets += lus;
+		size_t debut_lus = rempli;
+		rempli += lus;
+
+		// Fin de la dernière ligne complète, fin de ligne comprise
+		size_t fin = rempli;
+		while( fin > debut_lus && tampon[fin-1] != '\n' ) fin--;
+		if( fin == debut_lus ) continue;
+		nb_lignes += chercher_dans_texte( 
+			automate, mot_vide, tampon, fin, options 
+		);
+		memmove( tampon, tampon + fin, rempli - fin );
+		rempli -= fin;
+	}
+	xfree( tampon );
+	return nb_lignes;
+}
+
+/*
+ * Cherche dans le fichier 'nom' (« - » pour l'entrée standard). Renvoie le 
+ * nombre de lignes trouvées, ou -1 si le fichier ne peut pas être lu.
+ */
+long chercher_dans_fichier( 
+	const Automate_recherche * automate, int mot_vide, const char * nom,
+	const Options * options, size_t * nb_octets
+){
+	int fd = strcmp( nom, "-" ) ? open( nom, O_RDONLY ) : STDIN_FILENO;
+	if( fd < 0 ){
+		perror( nom );
+		return -1;
+	}
+	struct stat st;
+	long nb_lignes;
+	if( fstat( fd, &st ) == 0 && S_ISREG( st.st_mode ) && st.st_size > 0 ){
+		uint8_t * texte = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if( texte == MAP_FAILED ){
+			nb_lignes = chercher_dans_flux( 
+				automate, mot_vide, fd, options, nb_octets 
+			);
+		}else{
+			size_t taille = st.st_size;
+			*nb_octets += taille;
+			nb_lignes = chercher_dans_texte( 
+				automate, mot_vide, texte, taille, options 
+			);
+			munmap( texte, st.st_size );
+		}
+	}else{
+		nb_lignes = chercher_dans_flux( 
+			automate, mot_vide, fd, options, nb_octets 
+		);
+	}
+	if( fd != STDIN_FILENO ) close( fd );
+	return nb_lignes;
+}
+
+double chrono(){
+	struct timespec t;
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+void usage( const char * programme ){
+	fprintf( 
+		stderr, "usage : %s [-c] [-s] EXPRESSION [FICHIER...]\n", programme 
+	);
+	exit( 2 );
+}
+
+int main( int argc, char * argv[] ){
+	Options options = { 0, 0, NULL };
+	int opt;
+	while( ( opt = getopt( argc, argv, "cs" ) ) != -1 ){
+		switch( opt ){
+			case 'c': options.compter = 1; break;
+			case 's': options.statistiques = 1; break;
+			default: usage( argv[0] );
+		}
+	}
+	if( optind >= argc ) usage( argv[0] );
+
+	double debut = chrono();
+	Rationnel * rat = expression_to_rationnel( argv[optind] );
+	if( ! rat ){
+		fprintf( stderr, "Expression invalide : %s\n", argv[optind] );
+		return 2;
+	}
+	int mot_vide = contient_mot_vide( rat );
+	Automate_recherche * automate = compiler_rationnel_recherche( rat );
+	double compilation = chrono() - debut;
+
+	const char * entree_standard[] = { "-" };
+	const char ** fichiers = (const char**) argv + optind + 1;
+	int nb_fichiers = argc - optind - 1;
+	if( nb_fichiers == 0 ){
+		fichiers = entree_standard;
+		nb_fichiers = 1;
+	}
+
+	debut = chrono();
+	size_t nb_octets = 0;
+	int trouve = 0, erreur = 0;
+	int i;
+	for( i=0; i<nb_fichiers; i++ ){
+		options.prefixe = nb_fichiers > 1 ? fichiers[i] : NULL;
+		long nb_lignes = chercher_dans_fichier( 
+			automate, mot_vide, fichiers[i], &options, &nb_octets 
+		);
+		if( nb_lignes < 0 ){
+			erreur = 1;
+			continue;
+		}
+		if( nb_lignes > 0 ) trouve = 1;
+		if( options.compter ){
+			if( options.prefixe ) printf( "%s:", options.prefixe );
+			printf( "%ld\n", nb_lignes );
+		}
+	}
+	double lecture = chrono() - debut;
+
+	if( options.statistiques ){
+		fprintf( 
+			stderr, 
+			"compilation : %.3f ms, %d états, facteur obligatoire '%s'\n"
+			"lecture : %zu octets en %.3f s, %.1f Mo/s\n",
+			compilation * 1e3, automate->dense->nb_etats,
+			automate->facteur ? automate->facteur : "",
+			nb_octets, lecture, nb_octets / 1e6 / ( lecture > 0 ? lecture : 1e-9 )
+		);
+	}
+	liberer_automate_recherche( automate );
+	fflush( stdout );
+	return erreur ? 2 : ( trouve ? 0 : 1 );
+}
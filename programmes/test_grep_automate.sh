@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+#   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+#   à l'Université de Bordeaux
+#
+#   Copyright (C) 2015 Adrien Boussicault
+#
+#    This Library is free software: you can redistribute it and/or modify
+#    it under the terms of the GNU General Public License as published by
+#    the Free Software Foundation, either version 2 of the License, or
+#    (at your option) any later version.
+#
+#    This Library is distributed in the hope that it will be useful,
+#    but WITHOUT ANY WARRANTY; without even the implied warranty of
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#    GNU General Public License for more details.
+#
+#    You should have received a copy of the GNU General Public License
+#    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Vérifie le nombre de lignes trouvées par grep_automate, sur un fichier 
+# (lu avec mmap) et sur l'entrée standard (lue par morceaux).
+#
+#     test_grep_automate.sh [GREP_AUTOMATE]
+
+GREP_AUTOMATE=${1:-$(dirname "$0")/grep_automate}
+FICHIER=$(mktemp)
+trap 'rm -f "$FICHIER"' EXIT
+ECHEC=0
+
+# verifier EXPRESSION TEXTE ATTENDU
+verifier(){
+	printf "$2" > "$FICHIER"
+	local fichier=$("$GREP_AUTOMATE" -c "$1" "$FICHIER")
+	local entree=$(printf "$2" | "$GREP_AUTOMATE" -c "$1")
+	local lignes=$("$GREP_AUTOMATE" "$1" "$FICHIER" | wc -l)
+	if [ "$fichier" != "$3" ] || [ "$entree" != "$3" ] || [ "$lignes" != "$3" ]; then
+		echo "ECHEC : '$1' sur '$2' : $fichier (fichier), $entree (entrée standard), $lignes lignes affichées, $3 attendu"
+		ECHEC=1
+	fi
+}
+
+# Le mot vide est reconnu : toutes les lignes, vides comprises.
+verifier 'a*' 'a\n\n' 2
+verifier 'a*' 'ab\n\nxb\n\n' 4
+verifier 'a*' 'a\nb' 2
+verifier 'a*' '\n' 1
+verifier 'a*' 'a' 1
+
+# Le mot vide n'est pas reconnu.
+verifier 'a.b' 'ab\n\nxb\n\n' 1
+verifier 'a.b' 'xx\nab' 1
+verifier 'b' 'ab\n\nxb\n\n' 2
+
+exit $ECHEC
@@ -21,6 +21,7 @@
 #include "rationnel.h"
 #include "ensemble.h"
 #include "automate.h"
+#include "automate_equivalence.h"
 #include "parse.h"
 #include "scan.h"
 #include "outils.h"
@@ -29,6 +30,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 int Numb = 0;
 int yyparse(Rationnel **rationnel, yyscan_t scanner);
 
@@ -386,6 +388,225 @@ bool contient_mot_vide(Rationnel *rat)
 
 
 
+/*
+ * Un mot, qui peut contenir des octets nuls, utilisé par l'analyse des 
+ * facteurs obligatoires.
+ */
+typedef struct {
+    char *lettres;
+    size_t taille;
+} Mot;
+
+/*
+ * Ce que l'on sait des mots du langage d'une sous-expression : 'exact' s'il
+ * n'y a qu'un mot, 'mot', et sinon un préfixe, un suffixe et un facteur 
+ * communs à tous ses mots.
+ */
+typedef struct {
+    bool exact;
+    Mot prefixe;
+    Mot suffixe;
+    Mot facteur;
+} Facteurs;
+
+Mot creer_mot(const char *lettres, size_t taille)
+{
+    Mot res;
+    res.lettres = xmalloc(taille + 1);
+    memcpy(res.lettres, lettres, taille);
+    res.lettres[taille] = '\0';
+    res.taille = taille;
+    return res;
+}
+
+Mot concatener_mots(Mot u, Mot v)
+{
+    Mot res;
+    res.taille = u.taille + v.taille;
+    res.lettres = xmalloc(res.taille + 1);
+    memcpy(res.lettres, u.lettres, u.taille);
+    memcpy(res.lettres + u.taille, v.lettres, v.taille);
+    res.lettres[res.taille] = '\0';
+    return res;
+}
+
+/*
+ * Renvoie le plus long des deux mots et libère l'autre.
+ */
+Mot plus_long_mot(Mot u, Mot v)
+{
+    if (v.taille > u.taille)
+    {
+        xfree(u.lettres);
+        return v;
+    }
+    xfree(v.lettres);
+    return u;
+}
+
+Mot plus_long_prefixe_commun(Mot u, Mot v)
+{
+    size_t n = 0;
+    while (n < u.taille && n < v.taille && u.lettres[n] == v.lettres[n])
+        n++;
+    return creer_mot(u.lettres, n);
+}
+
+Mot plus_long_suffixe_commun(Mot u, Mot v)
+{
+    size_t n = 0;
+    while (n < u.taille && n < v.taille 
+            && u.lettres[u.taille - 1 - n] == v.lettres[v.taille - 1 - n])
+        n++;
+    return creer_mot(u.lettres + u.taille - n, n);
+}
+
+/*
+ * Plus long facteur commun de deux mots, par programmation dynamique sur 
+ * les longueurs des suffixes communs.
+ */
+Mot plus_long_facteur_commun(Mot u, Mot v)
+{
+    size_t *ligne = xmalloc((v.taille + 1) * sizeof(size_t));
+    size_t i, j, meilleur = 0, fin = 0;
+    for (j = 0; j <= v.taille; j++)
+        ligne[j] = 0;
+    for (i = 1; i <= u.taille; i++)
+    {
+        for (j = v.taille; j >= 1; j--)
+        {
+            ligne[j] = u.lettres[i - 1] == v.lettres[j - 1] ? ligne[j - 1] + 1 : 0;
+            if (ligne[j] > meilleur)
+            {
+                meilleur = ligne[j];
+                fin = i;
+            }
+        }
+    }
+    xfree(ligne);
+    return creer_mot(u.lettres + fin - meilleur, meilleur);
+}
+
+void liberer_facteurs(Facteurs f)
+{
+    xfree(f.prefixe.lettres);
+    xfree(f.suffixe.lettres);
+    xfree(f.facteur.lettres);
+}
+
+Facteurs facteurs_du_mot(Mot mot)
+{
+    Facteurs res;
+    res.exact = true;
+    res.prefixe = mot;
+    res.suffixe = creer_mot(mot.lettres, mot.taille);
+    res.facteur = creer_mot(mot.lettres, mot.taille);
+    return res;
+}
+
+Facteurs calculer_facteurs(Rationnel *rat)
+{
+    Facteurs res, g, d;
+    char lettre;
+
+    if (rat == NULL)
+    {
+        // Langage vide : on ne suppose rien.
+        res.exact = false;
+        res.prefixe = creer_mot("", 0);
+        res.suffixe = creer_mot("", 0);
+        res.facteur = creer_mot("", 0);
+        return res;
+    }
+
+    switch(get_etiquette(rat))
+    {
+        case EPSILON:
+            return facteurs_du_mot(creer_mot("", 0));
+
+        case LETTRE:
+            lettre = get_lettre(rat);
+            return facteurs_du_mot(creer_mot(&lettre, 1));
+
+        case STAR:
+            res.exact = false;
+            res.prefixe = creer_mot("", 0);
+            res.suffixe = creer_mot("", 0);
+            res.facteur = creer_mot("", 0);
+            return res;
+
+        case CONCAT:
+            g = calculer_facteurs(fils_gauche(rat));
+            d = calculer_facteurs(fils_droit(rat));
+            if (g.exact && d.exact)
+            {
+                res = facteurs_du_mot(concatener_mots(g.facteur, d.facteur));
+            }
+            else
+            {
+                // Dans chaque mot, le suffixe de gauche est suivi du 
+                // préfixe de droite.
+                res.exact = false;
+                res.prefixe = g.exact ? concatener_mots(g.facteur, d.prefixe)
+                    : creer_mot(g.prefixe.lettres, g.prefixe.taille);
+                res.suffixe = d.exact ? concatener_mots(g.suffixe, d.facteur)
+                    : creer_mot(d.suffixe.lettres, d.suffixe.taille);
+                res.facteur = plus_long_mot(
+                        concatener_mots(g.suffixe, d.prefixe),
+                        plus_long_mot(
+                            creer_mot(g.facteur.lettres, g.facteur.taille),
+                            creer_mot(d.facteur.lettres, d.facteur.taille)
+                        )
+                    );
+            }
+            liberer_facteurs(g);
+            liberer_facteurs(d);
+            return res;
+
+        case UNION:
+            g = calculer_facteurs(fils_gauche(rat));
+            d = calculer_facteurs(fils_droit(rat));
+            if (g.exact && d.exact && g.facteur.taille == d.facteur.taille
+                    && memcmp(g.facteur.lettres, d.facteur.lettres, g.facteur.taille) == 0)
+            {
+                res = facteurs_du_mot(creer_mot(g.facteur.lettres, g.facteur.taille));
+            }
+            else
+            {
+                res.exact = false;
+                res.prefixe = plus_long_prefixe_commun(g.prefixe, d.prefixe);
+                res.suffixe = plus_long_suffixe_commun(g.suffixe, d.suffixe);
+                res.facteur = plus_long_mot(
+                        plus_long_facteur_commun(g.facteur, d.facteur),
+                        plus_long_mot(
+                            creer_mot(res.prefixe.lettres, res.prefixe.taille),
+                            creer_mot(res.suffixe.lettres, res.suffixe.taille)
+                        )
+                    );
+            }
+            liberer_facteurs(g);
+            liberer_facteurs(d);
+            return res;
+
+        default:
+            assert(false);
+            break;
+    }
+    return res;
+}
+
+char *facteur_obligatoire(Rationnel *rat, size_t *taille)
+{
+    Facteurs f = calculer_facteurs(rat);
+    xfree(f.prefixe.lettres);
+    xfree(f.suffixe.lettres);
+    *taille = f.facteur.taille;
+    return f.facteur.lettres;
+}
+
+
+
+
 /* 
  * ===  FUNCTION  ======================================================================
  *         Name:  premier
@@ -703,74 +924,16 @@ Automate *Glushkov(Rationnel *rat)
 
 bool meme_langage (const char *expr1, const char* expr2)
 {
-
-
-
-    /*-----------------------------------------------------------------------------
-     *  create the Rationnel 
-     *-----------------------------------------------------------------------------*/
-    Rationnel *rat1 = expression_to_rationnel(expr1);
-    Rationnel *rat2 = expression_to_rationnel(expr2);
-    
-    /*-----------------------------------------------------------------------------
-     *  create the automata minimal
-     *-----------------------------------------------------------------------------*/
-    const Automate  *aut1 = creer_automate_minimal(Glushkov(rat1));
-    const Automate  *aut2 = creer_automate_minimal(Glushkov(rat2));
-   
-    
-    /*-----------------------------------------------------------------------------
-     *  check if the list of states,initials,finals are equals and if the alphabet is equal
-     *-----------------------------------------------------------------------------*/
-    bool test = iterateur_ensemble_est_vide(premier_iterateur_ensemble(creer_difference_ensemble(get_etats(aut1),get_etats(aut2)))) 
-        && iterateur_ensemble_est_vide(premier_iterateur_ensemble(creer_difference_ensemble(get_initiaux(aut1),get_initiaux(aut2))))
-        && iterateur_ensemble_est_vide(premier_iterateur_ensemble(creer_difference_ensemble(get_finaux(aut1),get_finaux(aut2))))
-        && iterateur_ensemble_est_vide(premier_iterateur_ensemble(creer_difference_ensemble(get_alphabet(aut1),get_alphabet(aut2))));
-
-
-    
     /*-----------------------------------------------------------------------------
-     *  now if the previus tests passed we check if the transitions are equal
+     *  compare the Glushkov automata pair by pair (Hopcroft-Karp), without
+     *  determinizing or minimizing them first
      *-----------------------------------------------------------------------------*/
-    if(test){
-        Table_iterateur tit1,tit2;
-        Ensemble_iterateur eit1,eit2;
-        for(
-                tit1 = premier_iterateur_table( aut1->transitions ),
-                tit2 =  premier_iterateur_table( aut2->transitions );
-                ! iterateur_est_vide( tit1 ) &&
-                ! iterateur_est_vide( tit2 );
-                tit1 = iterateur_suivant_table( tit1 ),
-                tit2 = iterateur_suivant_table( tit2 )
-
-           ){
-            Cle * cle1 = (Cle*) get_cle( tit1 );
-            Ensemble * fins1 = (Ensemble*) get_valeur( tit1 );
-            Cle * cle2 = (Cle*) get_cle( tit2 );
-            Ensemble * fins2 = (Ensemble*) get_valeur( tit2 );
-            for(
-                    eit1 = premier_iterateur_ensemble( fins1 ),
-                    eit2 = premier_iterateur_ensemble( fins2 );
-                    ! iterateur_ensemble_est_vide( eit1 ) &&
-                    ! iterateur_ensemble_est_vide( eit2 );
-                    eit1 = iterateur_suivant_ensemble( eit1 ),
-                    eit2 = iterateur_suivant_ensemble( eit2 )
-               ){
-                int fin1 = get_element( eit1 );
-                int fin2 = get_element( eit2 );
-                test = ((fin1 == fin2) && (cle1->origine == cle2->origine) && (cle1->lettre == cle2->lettre)); 
-            }
-
-        }
-
-    }
-
+    Automate *aut1 = Glushkov(expression_to_rationnel(expr1));
+    Automate *aut2 = Glushkov(expression_to_rationnel(expr2));
+    bool test = automates_equivalents(aut1, aut2, NULL, NULL);
+    liberer_automate(aut1);
+    liberer_automate(aut2);
     return test;
-
-
-
-
-
 }
 
 
@@ -1000,9 +1163,12 @@ Systeme resoudre_systeme(Systeme systeme, int n)
  */
 Rationnel *Arden(Automate *automate)
 {
+    // Le système a une ligne par numéro d'état : on numérote les états de 0
+    // à n-1.
+    Automate *compact = renumeroter_automate(automate, 0, NULL);
     int i;
-    i = get_max_etat(automate)+1;
-    Systeme ard = resoudre_systeme(systeme(automate),i);
+    i = get_max_etat(compact)+1;
+    Systeme ard = resoudre_systeme(systeme(compact),i);
 
 
 
@@ -1011,7 +1177,7 @@ Rationnel *Arden(Automate *automate)
     Rationnel *res = NULL;
 
     Ensemble_iterateur it;
-    const Ensemble * fins = get_initiaux(automate);
+    const Ensemble * fins = get_initiaux(compact);
     for( it = premier_iterateur_ensemble( fins );
             ! iterateur_ensemble_est_vide( it );
             it = iterateur_suivant_ensemble( it )
@@ -1026,6 +1192,7 @@ Rationnel *Arden(Automate *automate)
 
     }
 
+    liberer_automate(compact);
     return res;
 }
 
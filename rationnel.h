@@ -289,6 +289,27 @@ void numeroter_rationnel(Rationnel *rat);
  */
 bool contient_mot_vide(Rationnel *rat);
 
+/**
+ * @brief Calcule un facteur obligatoire d'une expression rationnelle : un mot
+ * qui est facteur de chaque mot de son langage.
+ *
+ * L'analyse parcourt l'arbre de l'expression : une lettre est son propre 
+ * facteur, une étoile n'en impose aucun, une concaténation garde le plus 
+ * long des facteurs de ses fils et de leur jonction (suffixe commun à 
+ * gauche suivi du préfixe commun à droite), et une union garde le plus long
+ * facteur commun à ses deux fils. Le facteur trouvé n'est pas toujours le 
+ * plus long possible, et il est vide si l'analyse n'en trouve pas.
+ *
+ * Un texte qui ne contient pas ce facteur ne contient aucun mot du langage :
+ * compiler_rationnel_recherche() s'en sert pour sauter les parties du texte
+ * qui ne le contiennent pas.
+ *
+ * @param rat L'expression rationnelle.
+ * @param taille L'adresse où écrire le nombre de lettres du facteur.
+ * @return Les lettres du facteur, suivies d'un '\0', à libérer avec xfree().
+ */
+char *facteur_obligatoire(Rationnel *rat, size_t *taille);
+
 /**
  * @brief @todo Calcule l'ensemble des positions des lettres pouvant apparaître comme première lettre d'un mot du langage d'une expression rationnelle.
  * @param rat L'expression rationnelle.
@@ -22,11 +22,13 @@
 #include "outils.h"
 #include "fifo.h"
 #include "avl.h"
+#include "arena.h"
 
 #include <assert.h>
 
 #include <search.h>
 #include <stdlib.h>
+#include <string.h>
 
 typedef struct Table_association {
 	void (*supprimer_cle)(intptr_t cle);
@@ -36,29 +38,216 @@ typedef struct Table_association {
 	intptr_t valeur;
 } Table_association ;
 
+/*
+ * Une entrée d'une table hachée. Les entrées sont rangées dans l'ordre 
+ * d'insertion ; une entrée supprimée reste en place (avec 'vivante' à 0)
+ * jusqu'au prochain rehachage.
+ */
+typedef struct Table_entree {
+	intptr_t cle;
+	intptr_t valeur;
+	uint64_t hache;
+	int vivante;
+} Table_entree;
+
+#define CASE_VIDE ((int32_t) -1)
+#define CASE_SUPPRIMEE ((int32_t) -2)
+
 struct Table {
 	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 );
 	intptr_t (*copier_cle)( const intptr_t cle );
 	void (*supprimer_cle)(intptr_t cle);
+	uint64_t (*hacher_cle)( const intptr_t cle );
+	Arena * arena;         /* NULL si la table est allouée par xmalloc() */
+	/* Table rangée dans un AVL */
 	struct avl_table * root;
+	/* Table hachée */
+	int est_hachee;
+	Table_entree * entrees;
+	size_t nb_entrees;
+	size_t capacite_entrees;
+	size_t nb_cles;
+	int32_t * cases;       /* Indices dans 'entrees', ou CASE_VIDE, ou CASE_SUPPRIMEE */
+	size_t nb_cases;       /* Une puissance de 2 */
 };
 
 
 intptr_t get_cle( Table_iterateur it ){
-	const Table_association * asso = ( const Table_association * ) avl_t_cur( &it );
+	if( it.table->est_hachee ){
+		return it.table->entrees[ it.position ].cle;
+	}
+	const Table_association * asso = ( const Table_association * ) avl_t_cur( &it.avl );
 	return (const intptr_t) asso->cle;
 }
 
 intptr_t get_valeur( Table_iterateur it ){
-	Table_association * asso = ( Table_association * ) avl_t_cur( &it );
+	if( it.table->est_hachee ){
+		return it.table->entrees[ it.position ].valeur;
+	}
+	Table_association * asso = ( Table_association * ) avl_t_cur( &it.avl );
 	return asso->valeur;
 }
 
+uint64_t hacher_entier( const intptr_t entier ){
+	uint64_t x = (uint64_t) entier;
+	x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+	return x ^ ( x >> 31 );
+}
+
+uint64_t hacher( const Table* table, const intptr_t cle ){
+	if( table->hacher_cle ){
+		return table->hacher_cle( cle );
+	}
+	return hacher_entier( cle );
+}
+
+int cles_egales( const Table* table, const intptr_t cle1, const intptr_t cle2 ){
+	if( table->comparer_cle ){
+		return table->comparer_cle( cle1, cle2 ) == 0;
+	}
+	return cle1 == cle2;
+}
+
+/*
+ * Renvoie la case d'une table hachée qui contient la clé passée en paramètre,
+ * ou -1 si la clé n'est pas dans la table.
+ */
+intptr_t chercher_case( const Table* table, const intptr_t cle, uint64_t hache ){
+	if( table->nb_cases == 0 ) return -1;
+	size_t masque = table->nb_cases - 1;
+	size_t i = hache & masque;
+	for( ;; i = ( i + 1 ) & masque ){
+		int32_t indice = table->cases[i];
+		if( indice == CASE_VIDE ) return -1;
+		if( 
+			indice != CASE_SUPPRIMEE 
+			&& table->entrees[indice].hache == hache
+			&& cles_egales( table, table->entrees[indice].cle, cle )
+		){
+			return i;
+		}
+	}
+}
+
+/*
+ * Range à nouveau toutes les entrées vivantes d'une table hachée, dans un 
+ * tableau de cases assez grand pour 'nb_cles' clés.
+ */
+void rehacher_table( Table* table, size_t nb_cles ){
+	size_t i, j;
+	size_t nb_cases = 16;
+	while( nb_cases * 3 < nb_cles * 4 + 4 ) nb_cases *= 2;
+
+	// On tasse les entrées vivantes au début du tableau.
+	for( i=0, j=0; i<table->nb_entrees; i++ ){
+		if( table->entrees[i].vivante ){
+			table->entrees[j++] = table->entrees[i];
+		}
+	}
+	table->nb_entrees = j;
+
+	rendre_arena( table->arena, table->cases );
+	table->cases = (int32_t*) allouer_arena( 
+		table->arena, nb_cases * sizeof(int32_t) 
+	);
+	table->nb_cases = nb_cases;
+	for( i=0; i<nb_cases; i++ ) table->cases[i] = CASE_VIDE;
+	for( j=0; j<table->nb_entrees; j++ ){
+		i = table->entrees[j].hache & ( nb_cases - 1 );
+		while( table->cases[i] != CASE_VIDE ) i = ( i + 1 ) & ( nb_cases - 1 );
+		table->cases[i] = j;
+	}
+}
+
+void add_table_hachee( Table* table, const intptr_t cle, intptr_t valeur ){
+	uint64_t hache = hacher( table, cle );
+	intptr_t c = chercher_case( table, cle, hache );
+	if( c >= 0 ){
+		table->entrees[ table->cases[c] ].valeur = valeur;
+		return;
+	}
+	// Les cases supprimées comptent dans le taux de remplissage.
+	if( ( table->nb_entrees + 1 ) * 4 > table->nb_cases * 3 ){
+		rehacher_table( table, 2 * ( table->nb_cles + 1 ) );
+	}
+	if( table->nb_entrees == table->capacite_entrees ){
+		size_t capacite = 
+			table->capacite_entrees ? 2 * table->capacite_entrees : 8;
+		table->entrees = (Table_entree*) reallouer_arena(
+			table->arena, table->entrees, 
+			table->capacite_entrees * sizeof(Table_entree),
+			capacite * sizeof(Table_entree)
+		);
+		table->capacite_entrees = capacite;
+	}
+	Table_entree * entree = &( table->entrees[ table->nb_entrees ] );
+	if( table->copier_cle && cle ){
+		entree->cle = table->copier_cle( cle );
+	}else{
+		entree->cle = cle;
+	}
+	entree->valeur = valeur;
+	entree->hache = hache;
+	entree->vivante = 1;
+
+	size_t masque = table->nb_cases - 1;
+	size_t i = hache & masque;
+	while( table->cases[i] >= 0 ) i = ( i + 1 ) & masque;
+	table->cases[i] = table->nb_entrees;
+	table->nb_entrees++;
+	table->nb_cles++;
+}
+
+intptr_t delete_table_hachee( Table* table, const intptr_t cle ){
+	intptr_t c = chercher_case( table, cle, hacher( table, cle ) );
+	if( c < 0 ) return (intptr_t) NULL;
+	Table_entree * entree = &( table->entrees[ table->cases[c] ] );
+	if( table->supprimer_cle && entree->cle ){
+		table->supprimer_cle( entree->cle );
+	}
+	entree->vivante = 0;
+	table->cases[c] = CASE_SUPPRIMEE;
+	table->nb_cles--;
+	return entree->valeur;
+}
+
+void vider_table_hachee( Table* table ){
+	size_t i;
+	for( i=0; i<table->nb_entrees; i++ ){
+		if( 
+			table->entrees[i].vivante 
+			&& table->supprimer_cle && table->entrees[i].cle 
+		){
+			table->supprimer_cle( table->entrees[i].cle );
+		}
+	}
+	for( i=0; i<table->nb_cases; i++ ) table->cases[i] = CASE_VIDE;
+	table->nb_entrees = 0;
+	table->nb_cles = 0;
+}
+
+/*
+ * Renvoie l'indice de la première entrée vivante d'une table hachée à partir
+ * de l'indice 'depart' (en avançant de 'pas'), ou -1 s'il n'y en a pas.
+ */
+intptr_t entree_vivante( const Table* table, intptr_t depart, int pas ){
+	intptr_t i;
+	for( 
+		i = depart; 
+		i >= 0 && i < (intptr_t) table->nb_entrees; 
+		i += pas 
+	){
+		if( table->entrees[i].vivante ) return i;
+	}
+	return -1;
+}
+
 Table_association * creer_table_association(
 	const Table* table, const intptr_t cle, intptr_t valeur
 ){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
+	Table_association * res = allouer_arena(
+		table->arena, sizeof( Table_association )
 	);
 	if( table->copier_cle && cle ){
 		res->cle = table->copier_cle( cle );
@@ -72,6 +261,20 @@ Table_association * creer_table_association(
 	return res;
 }
 
+/*
+ * Prépare, sans allocation ni copie de la clé, une association qui ne sert
+ * qu'à chercher la clé dans l'AVL. Elle ne doit pas être insérée dans l'arbre.
+ */
+void initialiser_sonde( 
+	Table_association * sonde, const Table* table, const intptr_t cle
+){
+	sonde->cle = cle;
+	sonde->valeur = (intptr_t) NULL;
+	sonde->supprimer_cle = NULL;
+	sonde->copier_cle = NULL;
+	sonde->comparer_cle = table->comparer_cle;
+}
+
 Table_association * copier_table_association( Table_association * asso ){
 	Table_association * res = xmalloc(
 		sizeof( Table_association )
@@ -99,12 +302,15 @@ int compare_table_association( const void * pa1, const void * pb1, void* param )
 }
 
 
+/*
+ * Fonction de destruction passée à l'AVL : 'data' est l'arène de la table.
+ */
 void supprimer_table_association2( void* asso_tmp, void* data ){
 	Table_association * asso = (Table_association*) asso_tmp;
 	if( asso->supprimer_cle && asso->cle ){
 		asso->supprimer_cle( asso->cle );
 	}
-	xfree(asso);
+	rendre_arena( (Arena*) data, asso );
 }
 
 void supprimer_table_association( Table_association * asso ){
@@ -114,13 +320,30 @@ void supprimer_table_association( Table_association * asso ){
 	xfree(asso);
 }
 
+struct avl_table * creer_avl_table( Arena* arena ){
+	return avl_create( 
+		compare_table_association, arena, allocateur_avl_arena( arena ) 
+	);
+}
+
 Table* creer_table(
 	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
 	intptr_t (*copier_cle)( const intptr_t cle ),
 	void (*supprimer_cle)(intptr_t cle)
 ){
-	Table* res = xmalloc( sizeof(Table) );
-	res->root = avl_create ( compare_table_association, NULL, NULL );
+	return creer_table_arena( NULL, comparer_cle, copier_cle, supprimer_cle );
+}
+
+Table* creer_table_arena(
+	Arena* arena,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_arena( arena, sizeof(Table) );
+	memset( res, 0, sizeof(Table) );
+	res->arena = arena;
+	res->root = creer_avl_table( arena );
 
 	res->supprimer_cle = supprimer_cle;
 	res->comparer_cle = comparer_cle;
@@ -128,41 +351,82 @@ Table* creer_table(
 	return res;
 }
 
+Table* creer_table_hachee(
+	uint64_t (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	return creer_table_hachee_arena(
+		NULL, hacher_cle, comparer_cle, copier_cle, supprimer_cle
+	);
+}
+
+Table* creer_table_hachee_arena(
+	Arena* arena,
+	uint64_t (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_arena( arena, sizeof(Table) );
+	memset( res, 0, sizeof(Table) );
+	res->arena = arena;
+	res->est_hachee = 1;
+	res->hacher_cle = hacher_cle;
+	res->supprimer_cle = supprimer_cle;
+	res->comparer_cle = comparer_cle;
+	res->copier_cle = copier_cle;
+	return res;
+}
+
 void liberer_table( Table* table ){
 	assert( table );
-	avl_destroy ( table->root, supprimer_table_association2 );
-	xfree( table );
+	if( table->arena && ! table->supprimer_cle ){
+		// Il n'y a rien à parcourir : la mémoire est rendue avec l'arène.
+		return;
+	}
+	if( table->est_hachee ){
+		vider_table_hachee( table );
+		rendre_arena( table->arena, table->entrees );
+		rendre_arena( table->arena, table->cases );
+	}else{
+		avl_destroy ( table->root, supprimer_table_association2 );
+	}
+	rendre_arena( table->arena, table );
 }
 
 void add_table( Table* table, const intptr_t cle, intptr_t valeur ) {
-	Table_association* asso = creer_table_association(table, cle, valeur);
-	void* val = avl_probe ( table->root, (void*) asso );
-	if( val == NULL ){
-		ERREUR( "Espace insuffisant" );
+	if( table->est_hachee ){
+		add_table_hachee( table, cle, valeur );
+		return;
 	}
-	Table_association* asso_tree = *( Table_association** ) val; 
-	if( asso_tree != asso  ){
-		supprimer_table_association( asso );
+	// On ne copie la clé que si elle n'est pas déjà dans la table.
+	Table_association sonde;
+	initialiser_sonde( &sonde, table, cle );
+	Table_association* asso_tree = avl_find( table->root, (void*) &sonde );
+	if( asso_tree ){
 		asso_tree->valeur = valeur;
+		return;
+	}
+	Table_association* asso = creer_table_association(table, cle, valeur);
+	if( avl_probe ( table->root, (void*) asso ) == NULL ){
+		ERREUR( "Espace insuffisant" );
 	}
 }
 
 intptr_t delete_table( Table* table, intptr_t cle ){
+	if( table->est_hachee ){
+		return delete_table_hachee( table, cle );
+	}
 	intptr_t valeur = (intptr_t) NULL;
-	Table_association* asso_tree = NULL;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	void* val = avl_find( table->root, (void*) asso );
-	if( val ){
-		asso_tree = ( Table_association* ) val; 
+	Table_association sonde;
+	initialiser_sonde( &sonde, table, cle );
+	Table_association* asso_tree = avl_delete( table->root, (void*) &sonde );
+	if( asso_tree ){
 		valeur = asso_tree->valeur;
+		supprimer_table_association2( asso_tree, table->arena );
 	}
-	avl_delete( table->root, (void*) asso );
-	if(asso_tree){
-		supprimer_table_association( asso_tree );
-	}
-	supprimer_table_association( asso );
 	return valeur;
 }
 
@@ -171,6 +435,15 @@ void pour_toute_cle_valeur_table(
 	void (* action)( const intptr_t cle, intptr_t valeur, void* data  ),
 	void* data
 ){
+	if( table->est_hachee ){
+		size_t i;
+		for( i=0; i<table->nb_entrees; i++ ){
+			if( table->entrees[i].vivante ){
+				action( table->entrees[i].cle, table->entrees[i].valeur, data );
+			}
+		}
+		return;
+	}
 	struct avl_traverser traverser;
 	void * item;
 	avl_t_init( &traverser, table->root );
@@ -199,8 +472,12 @@ void pour_toute_valeur_table(
 }
 
 void vider_table( Table* table ){
+	if( table->est_hachee ){
+		vider_table_hachee( table );
+		return;
+	}
 	avl_destroy ( table->root, supprimer_table_association2 );
-	table->root = avl_create ( compare_table_association, NULL, NULL );
+	table->root = creer_avl_table( table->arena );
 }
 
 typedef struct {
@@ -240,17 +517,26 @@ void print_table(
 
 Table_iterateur trouver_table( const Table* table, intptr_t cle ){
 	Table_iterateur it;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	avl_t_find( &it, table->root, (void*) asso );
-	supprimer_table_association( asso );
+	it.table = table;
+	if( table->est_hachee ){
+		intptr_t c = chercher_case( table, cle, hacher( table, cle ) );
+		it.position = ( c < 0 ) ? -1 : table->cases[c];
+		return it;
+	}
+	Table_association sonde;
+	initialiser_sonde( &sonde, table, cle );
+	avl_t_find( &it.avl, table->root, (void*) &sonde );
 	return it;
 }
 
 Table_iterateur premier_iterateur_table( const Table* table ){
 	Table_iterateur it;
-	avl_t_first( &it, table->root );
+	it.table = table;
+	if( table->est_hachee ){
+		it.position = entree_vivante( table, 0, 1 );
+		return it;
+	}
+	avl_t_first( &it.avl, table->root );
 	return it;
 }
 
@@ -258,33 +544,47 @@ Table_iterateur dernier_iterateur_table(
 	const Table_iterateur * iterator, Table* table 
 ){
 	Table_iterateur it;
-	avl_t_last( &it, table->root );
+	it.table = table;
+	if( table->est_hachee ){
+		it.position = entree_vivante( table, table->nb_entrees - 1, -1 );
+		return it;
+	}
+	avl_t_last( &it.avl, table->root );
 	return it;
 }
 
 int iterateur_est_vide( Table_iterateur iterator ){
-	return avl_t_is_null( &iterator );	
+	if( iterator.table->est_hachee ){
+		return iterator.position < 0;
+	}
+	return avl_t_is_null( &iterator.avl );	
 }
 
 Table_iterateur iterateur_suivant_table( Table_iterateur iterateur ){
-	avl_t_next( &iterateur );
+	if( iterateur.table->est_hachee ){
+		iterateur.position = entree_vivante( 
+			iterateur.table, iterateur.position + 1, 1 
+		);
+		return iterateur;
+	}
+	avl_t_next( &iterateur.avl );
 	return iterateur;
 }
 
 Table_iterateur iterateur_precedent_table( Table_iterateur iterateur ){
-	avl_t_prev( &iterateur );
+	if( iterateur.table->est_hachee ){
+		iterateur.position = entree_vivante( 
+			iterateur.table, iterateur.position - 1, -1 
+		);
+		return iterateur;
+	}
+	avl_t_prev( &iterateur.avl );
 	return iterateur;
 }
 
-int taille_table( Table* t ){
-	int res = 0;
-	Table_iterateur it1;
-	for(
-		it1 = premier_iterateur_table( t );
-		! iterateur_est_vide( it1 );
-		it1 = iterateur_suivant_table( it1 )
-	){
-		res += 1;
+int taille_table( const Table* t ){
+	if( t->est_hachee ){
+		return t->nb_cles;
 	}
-	return res;
-};
+	return avl_count( t->root );
+}
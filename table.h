@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include "avl.h"
+#include "arena.h"
 
 /**
  * @brief Définit le type d'une table.
@@ -39,7 +40,11 @@ typedef struct Table Table;
 /**
  * @brief Définit le type d'un itérateur sur les éléments d'une table.
  */
-typedef struct avl_traverser Table_iterateur;
+typedef struct {
+	const Table* table;
+	struct avl_traverser avl; //!< Pour une table rangée dans un AVL.
+	intptr_t position;        //!< Pour une table hachée, -1 si l'itérateur est vide.
+} Table_iterateur;
 
 /**
  * @brief Renvoie une nouvelle table.
@@ -150,6 +155,62 @@ Table* creer_table(
 	void (*supprimer_cle)(intptr_t cle)
 );
 
+/**
+ * @brief Renvoie une nouvelle table hachée.
+ *
+ * Les clés sont rangées dans une table de hachage à adressage ouvert : 
+ * trouver_table(), add_table() et delete_table() se font alors en temps 
+ * constant en moyenne, avec une seule comparaison de clés dans la plupart des
+ * cas. Les autres paramètres ont le même sens que pour creer_table().
+ *
+ * La fonction 'hacher_cle' doit renvoyer la même valeur pour deux clés 
+ * identiques (pour la fonction 'comparer_cle'). Si les clés sont des entiers,
+ * on peut mettre 'hacher_cle' à NULL : la table utilise alors hacher_entier().
+ *
+ * Une table hachée est parcourue dans l'ordre d'insertion des clés, et non
+ * dans l'ordre des clés. Si le parcours doit se faire dans l'ordre des clés,
+ * il faut utiliser une table créée par creer_table().
+ */
+Table* creer_table_hachee(
+	uint64_t (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
+/**
+ * @brief Renvoie une nouvelle table, rangée dans un AVL, dont toute la 
+ * mémoire (noeuds, associations, table) est prise dans l'arène 'arena'.
+ *
+ * Les paramètres ont le même sens que pour creer_table(). La mémoire des 
+ * clés copiées par 'copier_cle' reste à la charge de ces fonctions.
+ * Si 'supprimer_cle' est NULL, liberer_table() ne fait rien : la table 
+ * disparaît avec l'arène.
+ */
+Table* creer_table_arena(
+	Arena* arena,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
+/**
+ * @brief Renvoie une nouvelle table hachée dont toute la mémoire est prise
+ * dans l'arène 'arena' (voir creer_table_hachee() et creer_table_arena()).
+ */
+Table* creer_table_hachee_arena(
+	Arena* arena,
+	uint64_t (*hacher_cle)( const intptr_t cle ),
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
+/**
+ * @brief Renvoie une valeur de hachage, bien répartie sur 64 bits, d'un entier.
+ */
+uint64_t hacher_entier( const intptr_t entier );
+
 /**
  * @brief
  * Cette fonction détruit une table. La mémoire qui a été allouée par la table 
@@ -266,6 +327,14 @@ Table_iterateur trouver_table( const Table* table, const intptr_t cle );
  */
 Table_iterateur premier_iterateur_table( const Table* table );
 
+/*
+ * Renvoie un itérateur positionné sur la dernière association de la table.
+ * Le premier paramètre n'est pas utilisé.
+ */
+Table_iterateur dernier_iterateur_table(
+	const Table_iterateur * iterator, Table* table 
+);
+
 /**
  * @brief
  * Renvoie l'itérateur suivant.
@@ -319,8 +388,8 @@ intptr_t get_valeur( Table_iterateur it );
 
 /**
  * @brief
- * Renvoie la taille de la table.
+ * Renvoie la taille de la table, en temps constant.
  */
-int taille_table( Table* t );
+int taille_table( const Table* t );
 
 #endif
@@ -0,0 +1,138 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "arena.h"
+#include "table.h"
+#include "ensemble.h"
+#include "automate.h"
+#include "outils.h"
+
+#include <stdalign.h>
+#include <stddef.h>
+#include <string.h>
+
+int test_arena(){
+	int result = 1;
+
+	{
+		Arena * arena = creer_arena();
+		int i;
+		char * a = allouer_arena( arena, 3 );
+		char * b = allouer_arena( arena, 5 );
+		TEST( (uintptr_t) a % alignof(max_align_t) == 0, result );
+		TEST( (uintptr_t) b % alignof(max_align_t) == 0, result );
+		TEST( b >= a + 3, result );
+
+		// Le dernier bloc est agrandi sur place.
+		strcpy( b, "abcd" );
+		char * c = reallouer_arena( arena, b, 5, 100 );
+		TEST( c == b, result );
+		// Les autres sont recopiés.
+		strcpy( a, "xy" );
+		char * d = reallouer_arena( arena, a, 3, 50 );
+		TEST( d != a && strcmp( d, "xy" ) == 0, result );
+
+		// Gros blocs et nombreux petits blocs
+		char * gros = allouer_arena( arena, 1000000 );
+		memset( gros, 1, 1000000 );
+		for( i=0; i<100000; i++ ){
+			int * p = allouer_arena( arena, sizeof(int) );
+			*p = i;
+		}
+		TEST( strcmp( c, "abcd" ) == 0, result );
+		TEST( taille_arena( arena ) >= 1000000 + 100000 * sizeof(int), result );
+		rendre_arena( arena, gros );
+		liberer_arena( arena );
+	}
+
+	{
+		Arena * arena = creer_arena();
+		Table * avl = creer_table_arena( arena, NULL, NULL, NULL );
+		Table * hachee = creer_table_hachee_arena( arena, NULL, NULL, NULL, NULL );
+		int i;
+		for( i=0; i<1000; i++ ){
+			add_table( avl, i, 2*i );
+			add_table( hachee, i, 3*i );
+		}
+		for( i=0; i<1000; i+=2 ){
+			delete_table( avl, i );
+		}
+		TEST( taille_table( avl ) == 500, result );
+		TEST( taille_table( hachee ) == 1000, result );
+		TEST( get_valeur( trouver_table( avl, 11 ) ) == 22, result );
+		TEST( get_valeur( trouver_table( hachee, 10 ) ) == 30, result );
+		TEST( get_cle( premier_iterateur_table( avl ) ) == 1, result );
+		liberer_table( avl );
+		liberer_table( hachee );
+		liberer_arena( arena );
+	}
+
+	{
+		Arena * arena = creer_arena();
+		Ensemble * a = creer_ensemble_arena( arena, ENSEMBLE_AVL, NULL, NULL, NULL );
+		Ensemble * b = creer_ensemble_arena( arena, ENSEMBLE_BITSET, NULL, NULL, NULL );
+		Ensemble * t = creer_ensemble_arena( 
+			arena, ENSEMBLE_TABLEAU, NULL, NULL, NULL 
+		);
+		int i;
+		for( i=0; i<300; i+=3 ){
+			ajouter_element( a, i );
+			ajouter_element( b, 300-i );
+			ajouter_element( t, i );
+		}
+		ajouter_elements( t, b );
+		TEST( taille_ensemble( t ) == 101, result );
+		TEST( comparer_ensemble( a, t ) < 0, result );
+		retirer_element( t, 300 );
+		TEST( comparer_ensemble( a, t ) == 0, result );
+
+		// Les ensembles créés à partir d'un ensemble d'une arène n'y sont pas.
+		Ensemble * copie = copier_ensemble( t );
+		liberer_ensemble( a );
+		liberer_ensemble( b );
+		liberer_ensemble( t );
+		liberer_arena( arena );
+		TEST( taille_ensemble( copie ) == 100, result );
+		liberer_ensemble( copie );
+	}
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 0 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+		Automate * det = creer_automate_deterministe( automate );
+		liberer_automate( automate );
+		TEST( le_mot_est_reconnu( det, "abab" ), result );
+		TEST( ! le_mot_est_reconnu( det, "aba" ), result );
+		liberer_automate( det );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_arena() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_bits.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <string.h>
+
+/*
+ * Compare le_mot_est_reconnu() et le_mot_est_reconnu_bits() sur tous les 
+ * mots de longueur 'longueur' sur {a, b, c} qui prolongent 'mot'.
+ */
+int comparer_sur_les_mots( 
+	const Automate * automate, const Automate_bits * bits, 
+	char * mot, int position, int longueur
+){
+	if( position == longueur ){
+		mot[position] = '\0';
+		return le_mot_est_reconnu( automate, mot ) 
+			== le_mot_est_reconnu_bits( bits, mot );
+	}
+	const char * lettres = "abc";
+	int i;
+	for( i=0; i<3; i++ ){
+		mot[position] = lettres[i];
+		if( ! comparer_sur_les_mots( automate, bits, mot, position+1, longueur ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int comparer_avec_glushkov( const char * expression, int longueur_max ){
+	Automate * glushkov = Glushkov( expression_to_rationnel( expression ) );
+	Automate_bits * bits = compiler_automate_bits( glushkov );
+	int result = ( bits != NULL );
+	char mot[16];
+	int longueur;
+	for( longueur=0; result && longueur<=longueur_max; longueur++ ){
+		result = comparer_sur_les_mots( glushkov, bits, mot, 0, longueur );
+	}
+	liberer_automate_bits( bits );
+	liberer_automate( glushkov );
+	return result;
+}
+
+int test_automate_bits(){
+	int result = 1;
+
+	TEST( comparer_avec_glushkov( "a", 3 ), result );
+	TEST( comparer_avec_glushkov( "(a.b)*.a", 7 ), result );
+	TEST( comparer_avec_glushkov( "(a+b)*.c.(a+b+c)", 7 ), result );
+	TEST( comparer_avec_glushkov( "(a*.b*)*.c*", 7 ), result );
+	TEST( comparer_avec_glushkov( "((a.b+c)*.(b+c.a))*", 7 ), result );
+
+	{
+		// Plus de 64 positions : (a+b)*.a.(a+b)^40.c*
+		char expression[400] = "(a+b)*.a";
+		int i;
+		for( i=0; i<40; i++ ) strcat( expression, ".(a+b)" );
+		strcat( expression, ".c*" );
+		Automate_bits * bits = 
+			compiler_rationnel_bits( expression_to_rationnel( expression ) );
+		TEST( bits->nb_etats == 85 && bits->nb_mots == 2, result );
+
+		char mot[64];
+		memset( mot, 'b', 60 );
+		mot[60] = '\0';
+		TEST( ! le_mot_est_reconnu_bits( bits, mot ), result );
+		mot[19] = 'a';
+		TEST( le_mot_est_reconnu_bits( bits, mot ), result );
+		mot[59] = 'c';
+		TEST( ! le_mot_est_reconnu_bits( bits, mot ), result );
+		mot[18] = 'a';
+		TEST( le_mot_est_reconnu_bits( bits, mot ), result );
+		mot[18] = 'c';
+		TEST( ! le_mot_est_reconnu_bits( bits, mot ), result );
+		liberer_automate_bits( bits );
+	}
+
+	{
+		// Deux transitions qui arrivent sur l'état 1 avec des lettres 
+		// différentes.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 1 );
+		ajouter_etat_initial( automate, 0 );
+		TEST( compiler_automate_bits( automate ) == NULL, result );
+		liberer_automate( automate );
+	}
+
+	{
+		// Au plus NB_ETATS_MAX_BITS états : une chaîne de a.
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		int i;
+		for( i=1; i<NB_ETATS_MAX_BITS; i++ ){
+			ajouter_transition( automate, i-1, 'a', i );
+		}
+		ajouter_etat_final( automate, NB_ETATS_MAX_BITS - 1 );
+		Automate_bits * bits = compiler_automate_bits( automate );
+		TEST( bits && bits->nb_etats == NB_ETATS_MAX_BITS, result );
+		if( bits ) liberer_automate_bits( bits );
+		ajouter_transition( automate, NB_ETATS_MAX_BITS - 1, 'a', NB_ETATS_MAX_BITS );
+		TEST( compiler_automate_bits( automate ) == NULL, result );
+		liberer_automate( automate );
+
+		// Une expression de NB_ETATS_MAX_BITS positions
+		char * expression = xmalloc( 2 * NB_ETATS_MAX_BITS );
+		for( i=0; i<NB_ETATS_MAX_BITS; i++ ){
+			expression[2*i] = 'a';
+			expression[2*i+1] = '.';
+		}
+		expression[ 2 * NB_ETATS_MAX_BITS - 1 ] = '\0';
+		bits = compiler_rationnel_bits( expression_to_rationnel( expression ) );
+		TEST( bits == NULL, result );
+		xfree( expression );
+	}
+
+	{
+		Automate * automate = creer_automate();
+		Automate_bits * bits = compiler_automate_bits( automate );
+		TEST( ! le_mot_est_reconnu_bits( bits, "" ), result );
+		TEST( ! le_mot_est_reconnu_bits( bits, "a" ), result );
+		liberer_automate_bits( bits );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_bits() ){ return 1; }
+
+	return 0;
+}
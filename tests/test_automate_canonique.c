@@ -0,0 +1,122 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "rationnel.h"
+#include "outils.h"
+
+Automate * canonique_expression( const char * expression ){
+	Automate * glushkov = Glushkov( expression_to_rationnel( expression ) );
+	Automate * res = creer_automate_canonique( glushkov );
+	liberer_automate( glushkov );
+	return res;
+}
+
+/*
+ * Renvoie 1 si les deux expressions ont la même forme canonique et la même
+ * empreinte, 0 si elles ont des formes et des empreintes différentes, et -1
+ * si la forme et l'empreinte ne sont pas d'accord.
+ */
+int meme_forme_canonique( const char * expression1, const char * expression2 ){
+	Automate * a1 = canonique_expression( expression1 );
+	Automate * a2 = canonique_expression( expression2 );
+	int egaux = automates_canoniques_egaux( a1, a2 );
+	int empreintes = empreintes_egales( 
+		empreinte_automate_canonique( a1 ), empreinte_automate_canonique( a2 )
+	);
+	liberer_automate( a1 );
+	liberer_automate( a2 );
+	return egaux == empreintes ? egaux : -1;
+}
+
+int test_automate_canonique(){
+	int result = 1;
+
+	{
+		// (a.b)*.a : deux états, numérotés en largeur, sans puits.
+		Automate * canonique = canonique_expression( "(a.b)*.a" );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( canonique ) ) == 2
+			&& est_un_etat_initial_de_l_automate( canonique, 0 )
+			&& est_un_etat_final_de_l_automate( canonique, 1 )
+			&& ! est_un_etat_final_de_l_automate( canonique, 0 )
+			&& est_une_transition_de_l_automate( canonique, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( canonique, 1, 'b', 0 )
+			&& nombre_de_transitions( canonique ) == 2,
+			result
+		);
+		liberer_automate( canonique );
+	}
+
+	TEST( meme_forme_canonique( "(a.b)*.a", "a.(b.a)*" ) == 1, result );
+	TEST( meme_forme_canonique( "a.(b+c)", "a.b+a.c" ) == 1, result );
+	TEST( meme_forme_canonique( "(a*.b*)*", "(a+b)*" ) == 1, result );
+	TEST( meme_forme_canonique( "(a*)*.a", "a.a*" ) == 1, result );
+	TEST( meme_forme_canonique( "a.b", "b.a" ) == 0, result );
+	TEST( meme_forme_canonique( "a*", "a.a*" ) == 0, result );
+	TEST( meme_forme_canonique( "(a+b)*.a.b", "(a+b)*.b.a" ) == 0, result );
+
+	{
+		// Le langage ne dépend ni de l'alphabet ni des numéros des états.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 7, 'a', 3 );
+		ajouter_transition( automate, 3, 'b', 7 );
+		ajouter_transition( automate, 3, 'c', 12 );
+		ajouter_etat_initial( automate, 7 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_lettre( automate, 'z' );
+		Automate * glushkov = Glushkov( expression_to_rationnel( "(a.b)*.a" ) );
+		TEST( 
+			empreintes_egales( 
+				empreinte_langage( automate ), empreinte_langage( glushkov ) 
+			), result 
+		);
+		liberer_automate( glushkov );
+		liberer_automate( automate );
+	}
+
+	{
+		// Langage vide : un seul état, sans transition.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_etat_initial( automate, 0 );
+		Automate * canonique = creer_automate_canonique( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( canonique ) ) == 1
+			&& est_un_etat_initial_de_l_automate( canonique, 0 )
+			&& taille_ensemble( get_finaux( canonique ) ) == 0
+			&& nombre_de_transitions( canonique ) == 0,
+			result
+		);
+		liberer_automate( canonique );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_canonique() ){ return 1; }
+
+	return 0;
+}
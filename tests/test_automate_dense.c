@@ -0,0 +1,216 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_dense.h"
+#include "outils.h"
+
+#include <string.h>
+
+Automate * creer_automate_test(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 3, 'a', 10 );
+	ajouter_transition( automate, 3, 'a', 3 );
+	ajouter_transition( automate, 3, 'b', 3 );
+	ajouter_transition( automate, 10, 'b', -7 );
+	ajouter_transition( automate, 10, 'c', 100 );
+	ajouter_transition( automate, -7, 'a', 100 );
+	ajouter_transition( automate, 100, 'c', 3 );
+	ajouter_transition( automate, 100, 'b', 100 );
+	ajouter_transition( automate, 100, 'd', 55 );
+	ajouter_etat_initial( automate, 3 );
+	ajouter_etat_final( automate, 100 );
+	return automate;
+}
+
+/*
+ * Reconnaît 'mot' en trois morceaux : [0, coupure), un morceau vide et 
+ * [coupure, fin).
+ */
+int reconnu_par_morceaux( 
+	const Automate_dense * automate, const char * mot, int coupure 
+){
+	Lecture_dense lecture;
+	commencer_lecture_dense( &lecture, automate );
+	lire_morceau_dense( &lecture, mot, coupure );
+	lire_morceau_dense( &lecture, mot + coupure, 0 );
+	lire_morceau_dense( &lecture, mot + coupure, strlen( mot + coupure ) );
+	return terminer_lecture_dense( &lecture );
+}
+
+/*
+ * Compare le_mot_est_reconnu() et le_mot_est_reconnu_dense() sur tous les 
+ * mots de longueur 'longueur' sur {a, b, c, d, e} qui prolongent 'mot'.
+ */
+int comparer_sur_les_mots( 
+	const Automate * automate, const Automate_dense * dense, 
+	char * mot, int position, int longueur
+){
+	if( position == longueur ){
+		mot[position] = '\0';
+		int attendu = le_mot_est_reconnu( automate, mot );
+		int coupure;
+		for( coupure=0; coupure<=longueur; coupure++ ){
+			if( reconnu_par_morceaux( dense, mot, coupure ) != attendu ){
+				return 0;
+			}
+		}
+		return attendu == le_mot_est_reconnu_dense( dense, mot );
+	}
+	const char * lettres = "abcde";
+	int i;
+	for( i=0; i<5; i++ ){
+		mot[position] = lettres[i];
+		if( ! comparer_sur_les_mots( automate, dense, mot, position+1, longueur ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_automate_dense(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate_test();
+		TEST( compiler_automate( automate ) == NULL, result );
+
+		Automate * deterministe = creer_automate_deterministe( automate );
+		Automate_dense * dense = compiler_automate( deterministe );
+		TEST( dense != NULL, result );
+
+		// Les lettres 'b' et 'c' n'ont pas le même effet, 'd' ne mène qu'à 
+		// l'état puits et 'e' n'est pas une lettre de l'automate.
+		TEST( dense->classes['d'] == 0, result );
+		TEST( dense->classes['e'] == 0, result );
+		TEST( dense->classes['b'] != dense->classes['c'], result );
+		TEST( dense->nb_classes == 4, result );
+
+		char mot[8];
+		int longueur;
+		for( longueur=0; longueur<=6; longueur++ ){
+			TEST( 
+				comparer_sur_les_mots( automate, dense, mot, 0, longueur )
+				, result 
+			);
+		}
+
+		// L'automate compilé ne dépend plus de l'automate d'origine.
+		liberer_automate( automate );
+		liberer_automate( deterministe );
+		TEST( le_mot_est_reconnu_dense( dense, "aac" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "aacd" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "aacdbbbb" ), result );
+		TEST( le_mot_est_reconnu_dense( dense, "abacbb" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "" ), result );
+		liberer_automate_dense( dense );
+	}
+
+	{
+		// Des lettres qui ont le même effet partagent une classe.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'x', 1 );
+		ajouter_transition( automate, 0, 'y', 1 );
+		ajouter_transition( automate, 1, 'x', 1 );
+		ajouter_transition( automate, 1, 'y', 1 );
+		ajouter_transition( automate, 1, '\xe9', 0 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 1 );
+		Automate_dense * dense = compiler_automate( automate );
+		TEST( dense->nb_classes == 3, result );
+		TEST( dense->classes['x'] == dense->classes['y'], result );
+		TEST( le_mot_est_reconnu_dense( dense, "xyyx" ), result );
+		TEST( le_mot_est_reconnu_dense( dense, "x\xe9y" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "x\xe9" ), result );
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	{
+		// 256 lettres de colonnes différentes : 257 classes avec le puits.
+		Automate * automate = creer_automate();
+		int etat, octet;
+		for( etat=0; etat<=256; etat++ ){
+			for( octet=0; octet<256; octet++ ){
+				ajouter_transition( automate, etat, (char) octet, octet+1 );
+			}
+		}
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 256 );
+		Automate_dense * dense = compiler_automate( automate );
+		TEST( dense->nb_classes == 257, result );
+		TEST( dense->classes[255] == 256, result );
+		TEST( le_mot_est_reconnu_dense( dense, "\xff\xff" ), result );
+		TEST( le_mot_est_reconnu_dense( dense, "a\xff" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "\xff\xfe" ), result );
+		TEST( 
+			le_mot_est_reconnu_octets( automate, (const uint8_t *) "\xff\xff", 2 )
+			, result 
+		);
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	{
+		// La lecture par morceaux accepte les octets nuls.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, '\0', 1 );
+		ajouter_transition( automate, 1, 'a', 0 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 1 );
+		Automate_dense * dense = compiler_automate( automate );
+		Lecture_dense lecture;
+		commencer_lecture_dense( &lecture, dense );
+		lire_morceau_dense( &lecture, "\0a", 2 );
+		TEST( ! lecture_est_acceptante_dense( &lecture ), result );
+		lire_morceau_dense( &lecture, "\0", 1 );
+		TEST( lecture_est_acceptante_dense( &lecture ), result );
+		lire_morceau_dense( &lecture, "\0", 1 );
+		int reconnu = terminer_lecture_dense( &lecture );
+		TEST( ! reconnu, result );
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	{
+		Automate * automate = creer_automate();
+		Automate_dense * dense = compiler_automate( automate );
+		TEST( dense->nb_etats == 1, result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "ab" ), result );
+		liberer_automate_dense( dense );
+
+		ajouter_etat_initial( automate, 4 );
+		ajouter_etat_final( automate, 4 );
+		dense = compiler_automate( automate );
+		TEST( le_mot_est_reconnu_dense( dense, "" ), result );
+		TEST( ! le_mot_est_reconnu_dense( dense, "a" ), result );
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_dense() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "automate_equivalence.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdlib.h>
+
+Automate * automate_expression( const char * expression ){
+	return Glushkov( expression_to_rationnel( expression ) );
+}
+
+/*
+ * Compare les deux expressions. Renvoie -1 si le résultat est incohérent :
+ * contre-exemple reconnu par les deux automates ou par aucun, longueur 
+ * différente de 'longueur', ou désaccord avec les formes canoniques.
+ */
+int equivalentes( 
+	const char * expression1, const char * expression2, size_t longueur 
+){
+	Automate * a1 = automate_expression( expression1 );
+	Automate * a2 = automate_expression( expression2 );
+	uint8_t * mot = NULL;
+	size_t taille = 0;
+	int res = automates_equivalents( a1, a2, &mot, &taille );
+
+	Automate * c1 = creer_automate_canonique( a1 );
+	Automate * c2 = creer_automate_canonique( a2 );
+	if( automates_canoniques_egaux( c1, c2 ) != res ) res = -1;
+	if( res == 0 ){
+		if( 
+			le_mot_est_reconnu( a1, (const char *) mot ) ==
+			le_mot_est_reconnu( a2, (const char *) mot ) 
+			|| taille != longueur
+		){
+			res = -1;
+		}
+		xfree( mot );
+	}
+	liberer_automate( c1 );
+	liberer_automate( c2 );
+	liberer_automate( a1 );
+	liberer_automate( a2 );
+	return res;
+}
+
+int test_automate_equivalence(){
+	int result = 1;
+
+	TEST( equivalentes( "(a.b)*.a", "a.(b.a)*", 0 ) == 1, result );
+	TEST( equivalentes( "a.(b+c)", "a.b+a.c", 0 ) == 1, result );
+	TEST( equivalentes( "(a*.b*)*", "(a+b)*", 0 ) == 1, result );
+	TEST( equivalentes( "(a*)*.a", "a.a*", 0 ) == 1, result );
+	TEST( equivalentes( "a.b", "b.a", 2 ) == 0, result );
+	TEST( equivalentes( "a*", "a.a*", 0 ) == 0, result );
+	TEST( equivalentes( "(a+b)*.a.b", "(a+b)*.b.a", 2 ) == 0, result );
+	TEST( equivalentes( "(a+b)*.a.(a+b).(a+b)", "(a+b)*.b.(a+b).(a+b)", 3 ) == 0, result );
+	TEST( equivalentes( "a.a.a.a.a*", "a.a.a.a*", 3 ) == 0, result );
+	TEST( equivalentes( "a", "b", 1 ) == 0, result );
+
+	{
+		// Alphabets différents, états non contigus, automate non déterministe.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 7, 'a', 3 );
+		ajouter_transition( automate, 7, 'a', 12 );
+		ajouter_transition( automate, 3, 'b', 7 );
+		ajouter_transition( automate, 12, 'c', 40 );
+		ajouter_etat_initial( automate, 7 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_lettre( automate, 'z' );
+		Automate * glushkov = automate_expression( "(a.b)*.a" );
+		uint8_t * mot = NULL;
+		TEST( automates_equivalents( automate, glushkov, &mot, NULL ), result );
+		TEST( mot == NULL, result );
+		liberer_automate( glushkov );
+
+		// Le mot vide distingue un automate de son complémentaire de {mot vide}.
+		Automate * vide = creer_automate();
+		ajouter_etat_initial( vide, 0 );
+		ajouter_etat_final( vide, 0 );
+		size_t taille = 1;
+		TEST( ! automates_equivalents( automate, vide, &mot, &taille ), result );
+		TEST( mot && mot[0] == '\0' && taille == 0, result );
+		xfree( mot );
+		liberer_automate( vide );
+		liberer_automate( automate );
+	}
+
+	{
+		// Comparaison avec les formes canoniques sur des automates aléatoires.
+		srand( 17 );
+		int essai;
+		for( essai = 0; essai < 200; essai++ ){
+			Automate * automates[2];
+			int i;
+			for( i=0; i<2; i++ ){
+				automates[i] = creer_automate();
+				int n = 1 + rand() % 5;
+				int t;
+				for( t=0; t < 2 * n; t++ ){
+					ajouter_transition( 
+						automates[i], rand() % n, 'a' + rand() % 2, rand() % n 
+					);
+				}
+				ajouter_etat_initial( automates[i], 0 );
+				ajouter_etat_final( automates[i], rand() % n );
+			}
+			uint8_t * mot = NULL;
+			int res = automates_equivalents( 
+				automates[0], automates[1], &mot, NULL 
+			);
+			Automate * c1 = creer_automate_canonique( automates[0] );
+			Automate * c2 = creer_automate_canonique( automates[1] );
+			int attendu = automates_canoniques_egaux( c1, c2 );
+			int coherent = ( res == attendu ) && ( res || (
+				le_mot_est_reconnu( automates[0], (const char *) mot ) !=
+				le_mot_est_reconnu( automates[1], (const char *) mot )
+			) );
+			TEST( coherent, result );
+			xfree( mot );
+			liberer_automate( c1 );
+			liberer_automate( c2 );
+			liberer_automate( automates[0] );
+			liberer_automate( automates[1] );
+		}
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_equivalence() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_fige.h"
+#include "outils.h"
+
+#include <string.h>
+
+Automate * creer_automate_test(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 3, 'a', 10 );
+	ajouter_transition( automate, 3, 'a', 3 );
+	ajouter_transition( automate, 3, 'b', 3 );
+	ajouter_transition( automate, 10, 'b', -7 );
+	ajouter_transition( automate, 10, 'c', 100 );
+	ajouter_transition( automate, -7, 'a', 100 );
+	ajouter_transition( automate, 100, 'c', 3 );
+	ajouter_transition( automate, 100, 'b', 100 );
+	ajouter_etat( automate, 55 );
+	ajouter_etat_initial( automate, 3 );
+	ajouter_etat_initial( automate, 55 );
+	ajouter_etat_final( automate, 100 );
+	return automate;
+}
+
+void action_verifier_transition( int origine, char lettre, int fin, void* data ){
+	const Automate * automate = ( (void**) data )[0];
+	int * nb = ( (void**) data )[1];
+	if( est_une_transition_de_l_automate( automate, origine, lettre, fin ) ){
+		(*nb)++;
+	}
+}
+
+/*
+ * Reconnaît 'mot' en trois morceaux : [0, coupure), un morceau vide et 
+ * [coupure, fin).
+ */
+int reconnu_par_morceaux( 
+	const Automate_fige * automate, const char * mot, int coupure 
+){
+	Lecture_fige lecture;
+	commencer_lecture_fige( &lecture, automate );
+	lire_morceau_fige( &lecture, mot, coupure );
+	lire_morceau_fige( &lecture, mot + coupure, 0 );
+	lire_morceau_fige( &lecture, mot + coupure, strlen( mot + coupure ) );
+	return terminer_lecture_fige( &lecture );
+}
+
+/*
+ * Compare les deux versions de delta_star et de le_mot_est_reconnu sur tous
+ * les mots de longueur 'longueur' sur {a, b, c} qui prolongent 'mot'.
+ */
+int comparer_sur_les_mots( 
+	const Automate * automate, const Automate_fige * fige, 
+	char * mot, int position, int longueur
+){
+	if( position == longueur ){
+		mot[position] = '\0';
+		Ensemble * e1 = delta_star( automate, get_initiaux( automate ), mot );
+		Ensemble * e2 = delta_star_fige( fige, get_initiaux( automate ), mot );
+		int attendu = le_mot_est_reconnu( automate, mot );
+		int ok = 
+			comparer_ensemble( e1, e2 ) == 0
+			&& attendu == le_mot_est_reconnu_fige( fige, mot );
+		int coupure;
+		for( coupure=0; coupure<=longueur; coupure++ ){
+			ok &= reconnu_par_morceaux( fige, mot, coupure ) == attendu;
+		}
+		liberer_ensemble( e1 );
+		liberer_ensemble( e2 );
+		return ok;
+	}
+	const char * lettres = "abc";
+	int i;
+	for( i=0; i<3; i++ ){
+		mot[position] = lettres[i];
+		if( ! comparer_sur_les_mots( automate, fige, mot, position+1, longueur ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_automate_fige(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate_test();
+		Automate_fige * fige = figer_automate( automate );
+
+		TEST( fige->nb_etats == 5, result );
+		TEST( fige->nb_transitions == 8, result );
+		TEST( indice_etat_fige( fige, -7 ) == 0, result );
+		TEST( indice_etat_fige( fige, 100 ) == 4, result );
+		TEST( indice_etat_fige( fige, 4 ) == -1, result );
+
+		const int * cibles;
+		int n = voisins_fige( fige, indice_etat_fige( fige, 3 ), 'a', &cibles );
+		TEST( 
+			n == 2 
+			&& fige->etats[ cibles[0] ] == 3 
+			&& fige->etats[ cibles[1] ] == 10
+			, result 
+		);
+		n = voisins_fige( fige, indice_etat_fige( fige, 3 ), 'c', &cibles );
+		TEST( n == 0, result );
+		n = voisins_fige( fige, indice_etat_fige( fige, 55 ), 'a', &cibles );
+		TEST( n == 0, result );
+
+		Ensemble * e = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( e, 3 );
+		ajouter_element( e, 10 );
+		Ensemble * d1 = delta( automate, e, 'b' );
+		Ensemble * d2 = delta_fige( fige, e, 'b' );
+		TEST( comparer_ensemble( d1, d2 ) == 0, result );
+		liberer_ensemble( d1 );
+		liberer_ensemble( d2 );
+		liberer_ensemble( e );
+
+		int nb = 0;
+		void * data[2] = { automate, &nb };
+		pour_toute_transition_fige( fige, action_verifier_transition, data );
+		TEST( nb == nombre_de_transitions( automate ), result );
+
+		char mot[8];
+		int longueur;
+		for( longueur=0; longueur<=6; longueur++ ){
+			TEST( 
+				comparer_sur_les_mots( automate, fige, mot, 0, longueur )
+				, result 
+			);
+		}
+
+		// L'automate figé ne dépend plus de l'automate d'origine.
+		liberer_automate( automate );
+		TEST( le_mot_est_reconnu_fige( fige, "aac" ), result );
+		TEST( ! le_mot_est_reconnu_fige( fige, "aacc" ), result );
+		TEST( le_mot_est_reconnu_fige( fige, "abac" ), result );
+		liberer_automate_fige( fige );
+	}
+
+	{
+		Automate * automate = creer_automate();
+		Automate_fige * fige = figer_automate( automate );
+		TEST( fige->nb_etats == 0, result );
+		TEST( ! le_mot_est_reconnu_fige( fige, "" ), result );
+		TEST( ! le_mot_est_reconnu_fige( fige, "ab" ), result );
+		Lecture_fige lecture;
+		commencer_lecture_fige( &lecture, fige );
+		TEST( ! lecture_est_acceptante_fige( &lecture ), result );
+		lire_morceau_fige( &lecture, "ab", 2 );
+		int reconnu = terminer_lecture_fige( &lecture );
+		TEST( ! reconnu, result );
+		liberer_automate_fige( fige );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_fige() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_lot.h"
+#include "outils.h"
+
+#define NB_MOTS 1000
+
+/*
+ * Automate non déterministe de (a+b)*a(a+b)(a+b).
+ */
+Automate * creer_automate_test(){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_etat_final( automate, 3 );
+	return automate;
+}
+
+/*
+ * Reconnaît les NB_MOTS mots avec reconnaitre_lot() et compare avec 
+ * le_mot_est_reconnu_octets().
+ */
+int comparer_lot( 
+	const Automate * automate, const uint8_t * const * mots, 
+	const size_t * tailles, int nb_fils
+){
+	uint64_t resultats[ ( NB_MOTS + 63 ) / 64 ];
+	int i;
+	// Les bits doivent être écrits, qu'ils soient à 0 ou à 1.
+	for( i=0; i<( NB_MOTS + 63 ) / 64; i++ ) resultats[i] = i & 1 ? ~0 : 0;
+	reconnaitre_lot( automate, mots, tailles, NB_MOTS, resultats, nb_fils );
+	for( i=0; i<NB_MOTS; i++ ){
+		int reconnu = ( resultats[ i / 64 ] >> ( i % 64 ) ) & 1;
+		if( reconnu != le_mot_est_reconnu_octets( automate, mots[i], tailles[i] ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_automate_lot(){
+	int result = 1;
+
+	// Des mots pseudo-aléatoires de 0 à 19 lettres sur {a, b, c}
+	uint8_t * texte = xmalloc( NB_MOTS * 20 );
+	const uint8_t * mots[NB_MOTS];
+	size_t tailles[NB_MOTS];
+	unsigned int graine = 1;
+	int i;
+	for( i=0; i<NB_MOTS * 20; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = ( graine >> 16 ) % 16 ? 'a' + ( graine >> 20 ) % 2 : 'c';
+	}
+	for( i=0; i<NB_MOTS; i++ ){
+		mots[i] = texte + 20 * i;
+		graine = graine * 1103515245 + 12345;
+		tailles[i] = ( graine >> 16 ) % 20;
+	}
+
+	Automate * automate = creer_automate_test();
+	Automate * deterministe = creer_automate_deterministe( automate );
+
+	Automate_lot * lot = preparer_automate_lot( automate );
+	TEST( lot->dense == NULL && lot->fige != NULL, result );
+	liberer_automate_lot( lot );
+	lot = preparer_automate_lot( deterministe );
+	TEST( lot->dense != NULL && lot->fige == NULL, result );
+	liberer_automate_lot( lot );
+
+	TEST( comparer_lot( automate, mots, tailles, 1 ), result );
+	TEST( comparer_lot( automate, mots, tailles, 4 ), result );
+	TEST( comparer_lot( deterministe, mots, tailles, 1 ), result );
+	TEST( comparer_lot( deterministe, mots, tailles, 4 ), result );
+	TEST( comparer_lot( deterministe, mots, tailles, 100 ), result );
+
+	// Un lot plus petit que le nombre de mots lus en même temps
+	uint64_t resultats[1] = { 0 };
+	reconnaitre_lot( deterministe, mots + 10, tailles + 10, 3, resultats, 2 );
+	for( i=0; i<3; i++ ){
+		TEST( 
+			( ( resultats[0] >> i ) & 1 ) 
+				== le_mot_est_reconnu_octets( 
+					automate, mots[10+i], tailles[10+i] 
+				)
+			, result 
+		);
+	}
+	reconnaitre_lot( deterministe, mots, tailles, 0, resultats, 4 );
+
+	{
+		// Des mots vides donnés par un pointeur NULL
+		Automate * etoile = creer_automate();
+		ajouter_etat_initial( etoile, 0 );
+		ajouter_etat_final( etoile, 0 );
+		ajouter_transition( etoile, 0, 'a', 0 );
+		const uint8_t * vides[3] = { NULL, (const uint8_t *) "aa", NULL };
+		size_t tailles_vides[3] = { 0, 2, 0 };
+		resultats[0] = 0;
+		reconnaitre_lot( etoile, vides, tailles_vides, 3, resultats, 1 );
+		TEST( resultats[0] == 7, result );
+		reconnaitre_lot( deterministe, vides, tailles_vides, 3, resultats, 1 );
+		TEST( resultats[0] == 0, result );
+		liberer_automate( etoile );
+	}
+
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+	xfree( texte );
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_lot() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_motifs.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define NB_MOTIFS 70
+
+/*
+ * Compare reconnaitre_motifs() avec le_mot_est_reconnu_octets() sur chaque
+ * automate, pour 'nb_mots' mots pseudo-aléatoires sur "abcdx".
+ */
+int comparer_avec_chaque_automate( 
+	const Automate_motifs * motifs, Automate ** automates, int nb_motifs,
+	int nb_mots
+){
+	unsigned int graine = 1;
+	uint8_t mot[8];
+	int i, m;
+	for( i=0; i<nb_mots; i++ ){
+		graine = graine * 1103515245 + 12345;
+		size_t taille = ( graine >> 16 ) % 8;
+		size_t k;
+		for( k=0; k<taille; k++ ){
+			graine = graine * 1103515245 + 12345;
+			mot[k] = "abcdabcdx"[ ( graine >> 16 ) % 9 ];
+		}
+		const uint64_t * reconnus = reconnaitre_motifs( motifs, mot, taille );
+		for( m=0; m<nb_motifs; m++ ){
+			if( 
+				est_un_motif_reconnu( reconnus, m ) 
+				!= le_mot_est_reconnu_octets( automates[m], mot, taille ) 
+			){
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+int test_automate_motifs(){
+	int result = 1;
+	int m;
+
+	{
+		// Le motif m est formé des trois derniers chiffres de m en base 4, 
+		// écrits sur {a, b, c, d}, suivis de (a+d)* si m est impair : les 
+		// motifs 64 à 69 sont égaux aux motifs 0 à 5.
+		char expressions[NB_MOTIFS][32];
+		const char * pointeurs[NB_MOTIFS];
+		Automate * automates[NB_MOTIFS];
+		for( m=0; m<NB_MOTIFS; m++ ){
+			sprintf( 
+				expressions[m], "%c.%c.%c%s", 
+				"abcd"[ m / 16 % 4 ], "abcd"[ m / 4 % 4 ], "abcd"[ m % 4 ],
+				m % 2 ? ".(a+d)*" : ""
+			);
+			pointeurs[m] = expressions[m];
+			automates[m] = Glushkov( expression_to_rationnel( expressions[m] ) );
+		}
+		Automate_motifs * motifs = 
+			compiler_expressions_motifs( pointeurs, NB_MOTIFS );
+		TEST( motifs && motifs->nb_mots_motifs == 2, result );
+		TEST( 
+			comparer_avec_chaque_automate( 
+				motifs, automates, NB_MOTIFS, 20000 
+			), result 
+		);
+
+		const uint64_t * reconnus = 
+			reconnaitre_motifs( motifs, (const uint8_t*) "dbb", 3 );
+		TEST( est_un_motif_reconnu( reconnus, 53 ), result );
+		TEST( ! est_un_motif_reconnu( reconnus, 52 ), result );
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "abdadd", 6 );
+		TEST( 
+			reconnus[0] == (uint64_t) 1 << 7 && reconnus[1] == 0, result 
+		);
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "abdx", 4 );
+		TEST( reconnus[0] == 0 && reconnus[1] == 0, result );
+
+		liberer_automate_motifs( motifs );
+		for( m=0; m<NB_MOTIFS; m++ ){
+			liberer_automate( automates[m] );
+		}
+	}
+
+	{
+		// Deux motifs égaux et un motif non déterministe : a*.b, (a+b)*.b 
+		// et a*.b. L'automate minimal a cinq états : l'état initial, les 
+		// états atteints par b, par ba et par bb, et le puits.
+		Automate * automates[3];
+		automates[0] = Glushkov( expression_to_rationnel( "a*.b" ) );
+		automates[1] = creer_automate();
+		ajouter_transition( automates[1], 0, 'a', 0 );
+		ajouter_transition( automates[1], 0, 'b', 0 );
+		ajouter_transition( automates[1], 0, 'b', 1 );
+		ajouter_etat_initial( automates[1], 0 );
+		ajouter_etat_final( automates[1], 1 );
+		automates[2] = Glushkov( expression_to_rationnel( "a*.b" ) );
+		Automate_motifs * motifs = compiler_automates_motifs( 
+			(const Automate * const *) automates, 3 
+		);
+		TEST( 
+			comparer_avec_chaque_automate( motifs, automates, 3, 2000 ), result 
+		);
+		TEST( motifs->nb_etats == 5, result );
+		const uint64_t * reconnus = 
+			reconnaitre_motifs( motifs, (const uint8_t*) "aab", 3 );
+		TEST( reconnus[0] == 7, result );
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "bab", 3 );
+		TEST( reconnus[0] == 2, result );
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "", 0 );
+		TEST( reconnus[0] == 0, result );
+		liberer_automate_motifs( motifs );
+		for( m=0; m<3; m++ ){
+			liberer_automate( automates[m] );
+		}
+	}
+
+	{
+		// Un motif par octet : 256 colonnes différentes, plus celle du 
+		// puits, soit 257 classes d'octets.
+		Automate * automates[256];
+		for( m=0; m<256; m++ ){
+			automates[m] = creer_automate();
+			ajouter_transition( automates[m], 0, (char) m, 1 );
+			ajouter_etat_initial( automates[m], 0 );
+			ajouter_etat_final( automates[m], 1 );
+		}
+		Automate_motifs * motifs = compiler_automates_motifs( 
+			(const Automate * const *) automates, 256 
+		);
+		TEST( motifs->nb_classes == 257, result );
+		const uint64_t * reconnus = 
+			reconnaitre_motifs( motifs, (const uint8_t*) "\xff", 1 );
+		TEST( 
+			reconnus[3] == (uint64_t) 1 << 63 
+			&& ! reconnus[0] && ! reconnus[1] && ! reconnus[2], 
+			result 
+		);
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "", 1 );
+		TEST( reconnus[0] == 1 && ! reconnus[3], result );
+		reconnus = reconnaitre_motifs( motifs, (const uint8_t*) "\xff\xff", 2 );
+		TEST( ! reconnus[0] && ! reconnus[3], result );
+		liberer_automate_motifs( motifs );
+		for( m=0; m<256; m++ ){
+			liberer_automate( automates[m] );
+		}
+	}
+
+	{
+		// Aucun motif, et une expression invalide
+		Automate_motifs * motifs = compiler_automates_motifs( NULL, 0 );
+		TEST( 
+			reconnaitre_motifs( motifs, (const uint8_t*) "a", 1 )[0] == 0, 
+			result 
+		);
+		liberer_automate_motifs( motifs );
+		const char * expressions[] = { "a.b", "a.(" };
+		TEST( ! compiler_expressions_motifs( expressions, 2 ), result );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_motifs() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_parallele.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define TAILLE_TEXTE ( 1 << 20 )
+
+/*
+ * Compare la lecture parallèle avec la lecture séquentielle, pour plusieurs 
+ * nombres de fils, sur les préfixes du texte de plusieurs tailles.
+ */
+int comparer_avec_lecture_sequentielle( 
+	const Automate * automate, const uint8_t * texte 
+){
+	Automate_dense * dense = compiler_automate( automate );
+	int nb_fils[] = { 1, 2, 3, 8 };
+	size_t tailles[] = { 0, 1000, 200000, TAILLE_TEXTE - 7, TAILLE_TEXTE };
+	int res = 1;
+	int i, j;
+	for( i=0; i<4; i++ ){
+		for( j=0; j<5; j++ ){
+			Lecture_dense sequentielle, parallele;
+			commencer_lecture_dense( &sequentielle, dense );
+			lire_morceau_dense( &sequentielle, (const char*) texte, tailles[j] );
+			commencer_lecture_dense( &parallele, dense );
+			lire_morceau_dense_parallele( 
+				&parallele, (const char*) texte, tailles[j], nb_fils[i] 
+			);
+			if( sequentielle.etat != parallele.etat ) res = 0;
+		}
+	}
+	liberer_automate_dense( dense );
+	return res;
+}
+
+int test_automate_parallele(){
+	int result = 1;
+	int i;
+
+	uint8_t * texte = xmalloc( TAILLE_TEXTE );
+	unsigned int graine = 1;
+	for( i=0; i<TAILLE_TEXTE; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = ( ( graine >> 16 ) & 1 ) ? 'a' : 'b';
+	}
+
+	{
+		// Déterminisé de (a+b)*a(a+b)^8 : les lectures se rejoignent après 
+		// neuf lettres.
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		for( i=1; i<=8; i++ ){
+			ajouter_transition( automate, i, 'a', i+1 );
+			ajouter_transition( automate, i, 'b', i+1 );
+		}
+		ajouter_etat_final( automate, 9 );
+		Automate * deterministe = creer_automate_deterministe( automate );
+		TEST( comparer_avec_lecture_sequentielle( deterministe, texte ), result );
+		liberer_automate( deterministe );
+		liberer_automate( automate );
+	}
+
+	{
+		// Parité du nombre de a : les lectures ne se rejoignent jamais.
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 1, 'a', 0 );
+		ajouter_transition( automate, 1, 'b', 1 );
+		ajouter_etat_final( automate, 1 );
+		TEST( comparer_avec_lecture_sequentielle( automate, texte ), result );
+
+		Automate_dense * dense = compiler_automate( automate );
+		int nb_a = 0;
+		for( i=0; i<TAILLE_TEXTE; i++ ) nb_a += texte[i] == 'a';
+		TEST( 
+			le_mot_est_reconnu_dense_parallele( dense, texte, TAILLE_TEXTE, 4 )
+			== nb_a % 2, result 
+		);
+		liberer_automate_dense( dense );
+		liberer_automate( automate );
+	}
+
+	{
+		// (ab)* : les lectures tombent dans le puits, sauf si le texte est 
+		// fait de ab.
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 0 );
+		ajouter_etat_final( automate, 0 );
+		TEST( comparer_avec_lecture_sequentielle( automate, texte ), result );
+
+		uint8_t * ab = xmalloc( TAILLE_TEXTE );
+		for( i=0; i<TAILLE_TEXTE; i++ ) ab[i] = i % 2 ? 'b' : 'a';
+		TEST( comparer_avec_lecture_sequentielle( automate, ab ), result );
+		Automate_dense * dense = compiler_automate( automate );
+		TEST( 
+			le_mot_est_reconnu_dense_parallele( dense, ab, TAILLE_TEXTE, 4 ), 
+			result 
+		);
+		TEST( 
+			! le_mot_est_reconnu_dense_parallele( dense, ab, TAILLE_TEXTE - 1, 4 ),
+			result 
+		);
+		liberer_automate_dense( dense );
+		xfree( ab );
+		liberer_automate( automate );
+	}
+
+	xfree( texte );
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_parallele() ){ return 1; }
+
+	return 0;
+}
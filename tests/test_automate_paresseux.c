@@ -0,0 +1,169 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_paresseux.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define PROFONDEUR 6
+
+/*
+ * Automate non déterministe de (a+b)*a(a+b)^PROFONDEUR, dont l'automate 
+ * déterministe a 2^(PROFONDEUR+1) états.
+ */
+Automate * creer_automate_test(){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=PROFONDEUR; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, PROFONDEUR+1 );
+	return automate;
+}
+
+/*
+ * Compare le_mot_est_reconnu() et le_mot_est_reconnu_paresseux() sur tous 
+ * les mots de longueur 'longueur' sur {a, b, c} qui prolongent 'mot'.
+ */
+int comparer_sur_les_mots( 
+	const Automate * automate, Automate_paresseux * paresseux, 
+	char * mot, int position, int longueur
+){
+	if( position == longueur ){
+		mot[position] = '\0';
+		return le_mot_est_reconnu( automate, mot ) 
+			== le_mot_est_reconnu_paresseux( paresseux, mot );
+	}
+	const char * lettres = "abc";
+	int i;
+	for( i=0; i<3; i++ ){
+		mot[position] = lettres[i];
+		if( ! comparer_sur_les_mots( automate, paresseux, mot, position+1, longueur ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Compare les deux fonctions sur des mots pseudo-aléatoires sur {a, b} de 
+ * longueur 'longueur'.
+ */
+int comparer_sur_des_mots_longs( 
+	const Automate * automate, Automate_paresseux * paresseux, int longueur
+){
+	char * mot = xmalloc( longueur + 1 );
+	unsigned int graine = 1;
+	int i, n;
+	int result = 1;
+	for( n=0; n<20; n++ ){
+		for( i=0; i<longueur; i++ ){
+			graine = graine * 1103515245 + 12345;
+			mot[i] = ( ( graine >> 16 ) & 1 ) ? 'a' : 'b';
+		}
+		mot[longueur] = '\0';
+		result &= le_mot_est_reconnu( automate, mot ) 
+			== le_mot_est_reconnu_paresseux( paresseux, mot );
+	}
+	xfree( mot );
+	return result;
+}
+
+int test_automate_paresseux(){
+	int result = 1;
+	Automate * automate = creer_automate_test();
+	char mot[16];
+	int longueur;
+
+	{
+		// Le cache peut contenir tout l'automate déterministe.
+		Automate_paresseux * paresseux = 
+			creer_automate_paresseux( automate, 1 << 20 );
+		for( longueur=0; longueur<=9; longueur++ ){
+			TEST( 
+				comparer_sur_les_mots( automate, paresseux, mot, 0, longueur )
+				, result 
+			);
+		}
+		TEST( comparer_sur_des_mots_longs( automate, paresseux, 2000 ), result );
+		TEST( paresseux->nb_vidages == 0, result );
+		// Les 2^(PROFONDEUR+1) ensembles et l'ensemble vide
+		TEST( paresseux->nb_etats == ( 1 << ( PROFONDEUR+1 ) ) + 1, result );
+		liberer_automate_paresseux( paresseux );
+	}
+
+	{
+		// Le cache est vidé entre les mots et pendant leur lecture.
+		Automate_paresseux * paresseux = 
+			creer_automate_paresseux( automate, 20 * 1024 );
+		TEST( paresseux->nb_max_etats < 32, result );
+		for( longueur=0; longueur<=9; longueur++ ){
+			TEST( 
+				comparer_sur_les_mots( automate, paresseux, mot, 0, longueur )
+				, result 
+			);
+		}
+		TEST( comparer_sur_des_mots_longs( automate, paresseux, 2000 ), result );
+		TEST( paresseux->nb_vidages > 0, result );
+		TEST( paresseux->nb_etats <= paresseux->nb_max_etats, result );
+		liberer_automate_paresseux( paresseux );
+	}
+
+	{
+		// Deux états seulement : la lecture finit sur l'automate non 
+		// déterministe.
+		Automate_paresseux * paresseux = creer_automate_paresseux( automate, 0 );
+		TEST( paresseux->nb_max_etats == 2, result );
+		for( longueur=0; longueur<=9; longueur++ ){
+			TEST( 
+				comparer_sur_les_mots( automate, paresseux, mot, 0, longueur )
+				, result 
+			);
+		}
+		TEST( comparer_sur_des_mots_longs( automate, paresseux, 2000 ), result );
+		liberer_automate_paresseux( paresseux );
+	}
+
+	liberer_automate( automate );
+
+	{
+		Automate * vide = creer_automate();
+		Automate_paresseux * paresseux = creer_automate_paresseux( vide, 0 );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "" ), result );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "ab" ), result );
+		liberer_automate_paresseux( paresseux );
+		liberer_automate( vide );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_paresseux() ){ return 1; }
+
+	return 0;
+}
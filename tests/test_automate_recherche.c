@@ -0,0 +1,210 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_recherche.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define TAILLE_TEXTE 300
+
+typedef struct {
+	size_t positions[TAILLE_TEXTE + 1];
+	int nb;
+} Occurrences;
+
+void action_noter_occurrence( size_t fin, void* data ){
+	Occurrences * o = (Occurrences*) data;
+	o->positions[ o->nb++ ] = fin;
+}
+
+/*
+ * Compare rechercher_occurrences() avec la recherche naïve : 'fin' est une
+ * occurrence si un facteur texte[debut..fin) est reconnu.
+ */
+int comparer_occurrences( 
+	const Automate_recherche * recherche, const Automate * automate, 
+	const uint8_t * texte, size_t taille 
+){
+	Occurrences occurrences;
+	occurrences.nb = 0;
+	rechercher_occurrences( 
+		recherche, texte, taille, action_noter_occurrence, &occurrences 
+	);
+
+	int nb = 0;
+	size_t debut, fin;
+	for( fin=0; fin<=taille; fin++ ){
+		for( debut=0; debut<=fin; debut++ ){
+			if( le_mot_est_reconnu_octets( automate, texte + debut, fin - debut ) ){
+				if( nb >= occurrences.nb || occurrences.positions[nb] != fin ){
+					return 0;
+				}
+				nb++;
+				break;
+			}
+		}
+	}
+	return nb == occurrences.nb;
+}
+
+int comparer_avec_recherche_naive( 
+	const Automate * automate, const uint8_t * texte, size_t taille 
+){
+	Automate_recherche * recherche = compiler_automate_recherche( automate );
+	int res = comparer_occurrences( recherche, automate, texte, taille );
+	liberer_automate_recherche( recherche );
+	return res;
+}
+
+/*
+ * Même comparaison pour une expression, avec son facteur obligatoire.
+ */
+int comparer_expression_avec_recherche_naive( 
+	const char * expression, const char * facteur,
+	const uint8_t * texte, size_t taille 
+){
+	Rationnel * rat = expression_to_rationnel( expression );
+	Automate_recherche * recherche = compiler_rationnel_recherche( rat );
+	Automate * glushkov = Glushkov( rat );
+	int res = 
+		( facteur ? 
+			recherche->facteur && strcmp( recherche->facteur, facteur ) == 0 
+			: ! recherche->facteur
+		)
+		&& comparer_occurrences( recherche, glushkov, texte, taille );
+	liberer_automate( glushkov );
+	liberer_automate_recherche( recherche );
+	return res;
+}
+
+int test_automate_recherche(){
+	int result = 1;
+
+	// Un texte pseudo-aléatoire sur {a, b, c, x, \0}
+	uint8_t texte[TAILLE_TEXTE];
+	unsigned int graine = 1;
+	int i;
+	for( i=0; i<TAILLE_TEXTE; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = "abcx\0abab"[ ( graine >> 16 ) % 9 ];
+	}
+
+	{
+		// ab(a+b)*c, non déterministe
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_transition( automate, 2, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 2 );
+		ajouter_transition( automate, 2, 'c', 3 );
+		ajouter_transition( automate, 2, 'b', 4 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_etat_final( automate, 4 );
+		TEST( comparer_avec_recherche_naive( automate, texte, TAILLE_TEXTE ), result );
+
+		Automate_recherche * recherche = compiler_automate_recherche( automate );
+		TEST( recherche->nb_premieres == 1 && recherche->premiere == 'a', result );
+		Occurrences occurrences;
+		occurrences.nb = 0;
+		rechercher_occurrences( 
+			recherche, (const uint8_t*) "xxabxabbcab", 11, 
+			action_noter_occurrence, &occurrences 
+		);
+		// "abb" finit en 8 et "abbc" en 9.
+		TEST( occurrences.nb == 2, result );
+		TEST( occurrences.positions[0] == 8, result );
+		TEST( occurrences.positions[1] == 9, result );
+		liberer_automate_recherche( recherche );
+		liberer_automate( automate );
+	}
+
+	{
+		// Plusieurs premières lettres et un état initial final : b*+ca
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 1, 'c', 2 );
+		ajouter_transition( automate, 2, 'a', 3 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_initial( automate, 1 );
+		ajouter_etat_final( automate, 0 );
+		ajouter_etat_final( automate, 3 );
+		TEST( comparer_avec_recherche_naive( automate, texte, TAILLE_TEXTE ), result );
+		liberer_automate( automate );
+
+		automate = creer_automate();
+		ajouter_transition( automate, 0, 'b', 1 );
+		ajouter_transition( automate, 0, '\0', 1 );
+		ajouter_transition( automate, 1, 'c', 2 );
+		ajouter_transition( automate, 2, 'a', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+		TEST( comparer_avec_recherche_naive( automate, texte, TAILLE_TEXTE ), result );
+		liberer_automate( automate );
+	}
+
+	{
+		// Avec un facteur obligatoire
+		TEST( 
+			comparer_expression_avec_recherche_naive( 
+				"a*.b.c.(a+b)*", "bc", texte, TAILLE_TEXTE 
+			), result 
+		);
+		TEST( 
+			comparer_expression_avec_recherche_naive( 
+				"(a.b)*.a.b.a.(c+x)", "aba", texte, TAILLE_TEXTE 
+			), result 
+		);
+		TEST( 
+			comparer_expression_avec_recherche_naive( 
+				"(a+b)*.c.x+b.c.a*", NULL, texte, TAILLE_TEXTE 
+			), result 
+		);
+		TEST( 
+			comparer_expression_avec_recherche_naive( 
+				"x.x.(a+b+c)*.x.x", "xx", texte, TAILLE_TEXTE 
+			), result 
+		);
+		TEST( 
+			comparer_expression_avec_recherche_naive( 
+				"a.b.a.b.a.b.a.b", "abababab", texte, TAILLE_TEXTE 
+			), result 
+		);
+	}
+
+	{
+		// Langage vide
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_etat_initial( automate, 0 );
+		TEST( comparer_avec_recherche_naive( automate, texte, TAILLE_TEXTE ), result );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_automate_recherche() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <string.h>
+
+/*
+ * Compare deux automates sur tous les mots de longueur au plus 'taille_max'
+ * sur {a, b, c}.
+ */
+int meme_langage_jusqu_a( const Automate * a1, const Automate * a2, int taille_max ){
+	char mot[16];
+	int taille, i;
+	for( taille=0; taille<=taille_max; taille++ ){
+		int compteur[16];
+		memset( compteur, 0, sizeof(compteur) );
+		for( ;; ){
+			for( i=0; i<taille; i++ ) mot[i] = "abc"[ compteur[i] ];
+			mot[taille] = '\0';
+			if( le_mot_est_reconnu( a1, mot ) != le_mot_est_reconnu( a2, mot ) ){
+				return 0;
+			}
+			for( i=0; i<taille && compteur[i] == 2; i++ ) compteur[i] = 0;
+			if( i == taille ) break;
+			compteur[i]++;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Vérifie que tous les états ont une transition par lettre de l'alphabet.
+ */
+int est_complet( const Automate * automate ){
+	return nombre_de_transitions( automate ) == 
+		taille_ensemble( get_etats( automate ) ) 
+		* taille_ensemble( get_alphabet( automate ) );
+}
+
+int test_creer_automate_minimal_hopcroft(){
+	int resultat = 1;
+
+	{
+		// Sans état initial : seul le puits reste.
+		Automate* automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 0, 'b', 3 );
+		Automate* minimal = creer_automate_minimal_hopcroft( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( minimal ) ) == 1
+			&& est_un_etat_initial_de_l_automate( minimal, 0 )
+			&& taille_ensemble( get_finaux( minimal ) ) == 0
+			&& est_complet( minimal ),
+			resultat
+		);	
+		liberer_automate( minimal );
+		liberer_automate( automate );
+	}
+
+	{
+		// Le second exemple de test_creer_automate_minimal.c
+		Automate* automate = creer_automate();
+		ajouter_etat_final( automate, 8 );
+		ajouter_etat_final( automate, 10 );
+		ajouter_etat_final( automate, 6 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 0, 'b', 1 );
+		ajouter_transition( automate, 1, 'a', 3 );
+		ajouter_transition( automate, 1, 'b', 0 );
+		ajouter_transition( automate, 2, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 3 );
+		ajouter_transition( automate, 3, 'a', 2 );
+		ajouter_transition( automate, 3, 'b', 3 );
+		ajouter_transition( automate, 7, 'a', 1 );
+		ajouter_transition( automate, 6, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 10 );
+		ajouter_transition( automate, 10, 'a', 10 );
+		Automate* minimal = creer_automate_minimal_hopcroft( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( minimal ) ) == 2
+			&& est_un_etat_initial_de_l_automate( minimal, 0 )
+			&& est_un_etat_final_de_l_automate( minimal, 1 )
+			&& ! est_un_etat_final_de_l_automate( minimal, 0 )
+			&& est_une_transition_de_l_automate( minimal, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( minimal, 0, 'b', 0 )
+			&& est_une_transition_de_l_automate( minimal, 1, 'a', 1 )
+			&& est_une_transition_de_l_automate( minimal, 1, 'b', 1 )
+			&& nombre_de_transitions( minimal ) == 4,
+			resultat
+		);	
+		liberer_automate( minimal );
+		liberer_automate( automate );
+	}
+
+	{
+		// Automates pseudo-aléatoires : même langage et même nombre d'états
+		// que par l'algorithme de Brzozowski.
+		unsigned int graine = 1;
+		int essai, i;
+		for( essai=0; essai<200; essai++ ){
+			Automate * automate = creer_automate();
+			int nb_etats = 2 + essai % 7;
+			int nb_transitions = nb_etats * ( 1 + essai % 3 );
+			for( i=0; i<nb_transitions; i++ ){
+				graine = graine * 1103515245 + 12345;
+				int origine = ( graine >> 16 ) % nb_etats;
+				graine = graine * 1103515245 + 12345;
+				int fin = ( graine >> 16 ) % nb_etats;
+				graine = graine * 1103515245 + 12345;
+				ajouter_transition( automate, origine, "abc"[ ( graine >> 16 ) % 3 ], fin );
+			}
+			ajouter_etat_initial( automate, 0 );
+			if( essai % 5 == 4 ) ajouter_etat_initial( automate, 1 );
+			graine = graine * 1103515245 + 12345;
+			ajouter_etat_final( automate, ( graine >> 16 ) % nb_etats );
+			if( essai % 3 == 0 ) ajouter_etat_final( automate, nb_etats - 1 );
+
+			Automate * hopcroft = creer_automate_minimal_hopcroft( automate );
+			Automate * brzozowski = creer_automate_minimal( automate );
+			TEST(
+				1
+				&& meme_langage_jusqu_a( automate, hopcroft, 6 )
+				&& est_complet( hopcroft )
+				&& taille_ensemble( get_etats( hopcroft ) ) 
+					== taille_ensemble( get_etats( brzozowski ) ),
+				resultat
+			);
+			liberer_automate( brzozowski );
+			liberer_automate( hopcroft );
+			liberer_automate( automate );
+		}
+	}
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_creer_automate_minimal_hopcroft() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+
+#define TAILLE_MOT 20000
+#define GRAND_ETAT 50000000
+
+int test_delta_star(){
+	int result = 1;
+
+	{
+		// Le plus petit et le plus grand état, états négatifs compris
+		Automate * automate = creer_automate();
+		TEST( get_min_etat( automate ) == INT_MAX, result );
+		TEST( get_max_etat( automate ) == INT_MIN, result );
+		ajouter_transition( automate, 3, 'a', -7 );
+		ajouter_etat( automate, 12 );
+		ajouter_etat( automate, -2 );
+		TEST( get_min_etat( automate ) == -7, result );
+		TEST( get_max_etat( automate ) == 12, result );
+		liberer_automate( automate );
+	}
+
+	{
+		// Le dernier élément de chaque représentation d'ensemble
+		Ensemble * ensembles[3] = {
+			creer_ensemble( NULL, NULL, NULL ),
+			creer_ensemble_bitset(),
+			creer_ensemble_tableau( NULL, NULL, NULL )
+		};
+		int i;
+		for( i=0; i<3; i++ ){
+			TEST( 
+				iterateur_ensemble_est_vide( 
+					dernier_iterateur_ensemble( ensembles[i] ) 
+				), result 
+			);
+			ajouter_element( ensembles[i], 5 );
+			ajouter_element( ensembles[i], 130 );
+			ajouter_element( ensembles[i], 64 );
+			TEST( 
+				get_element( dernier_iterateur_ensemble( ensembles[i] ) ) == 130,
+				result 
+			);
+			liberer_ensemble( ensembles[i] );
+		}
+	}
+
+	{
+		// Un très grand numéro d'état : les ensembles d'états courants ne 
+		// doivent pas être des tableaux de bits à la taille de ce numéro.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', GRAND_ETAT );
+		ajouter_transition( automate, GRAND_ETAT, 'b', 0 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 0 );
+		char * mot = xmalloc( TAILLE_MOT + 1 );
+		int i;
+		for( i=0; i<TAILLE_MOT; i++ ) mot[i] = i % 2 ? 'b' : 'a';
+		mot[TAILLE_MOT] = '\0';
+
+		clock_t debut = clock();
+		int reconnu = le_mot_est_reconnu( automate, mot );
+		double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+		TEST( reconnu, result );
+		// Un tableau de bits de GRAND_ETAT bits par lettre prendrait 
+		// plusieurs secondes.
+		TEST( duree < 1, result );
+
+		mot[TAILLE_MOT-1] = '\0';
+		Ensemble * arrivee = delta_star( automate, get_initiaux( automate ), mot );
+		TEST( 
+			taille_ensemble( arrivee ) == 1 
+				&& est_dans_l_ensemble( arrivee, GRAND_ETAT )
+			, result 
+		);
+		liberer_ensemble( arrivee );
+		xfree( mot );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_delta_star() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdarg.h>
+
+Ensemble * bitset( int n, ... ){
+	va_list pile;
+	int i;
+	Ensemble * e = creer_ensemble_bitset();
+	va_start(pile,n);
+	for (i=0;i<n;i++){
+		ajouter_element( e, va_arg(pile,int) ); 
+ 	}
+	va_end(pile);
+	return e;
+}
+
+Ensemble * avl( int n, ... ){
+	va_list pile;
+	int i;
+	Ensemble * e = creer_ensemble( NULL, NULL, NULL );
+	va_start(pile,n);
+	for (i=0;i<n;i++){
+		ajouter_element( e, va_arg(pile,int) ); 
+ 	}
+	va_end(pile);
+	return e;
+}
+
+int signe( int x ){
+	return ( x > 0 ) - ( x < 0 );
+}
+
+int test_ensemble_bitset(){
+	int result = 1;
+
+	{
+		Ensemble * e = bitset( 5, 3, 64, 0, 200, 3 );
+		Ensemble * a = avl( 4, 0, 3, 64, 200 );
+
+		TEST(
+			1
+			&& taille_ensemble( e ) == 4
+			&& est_dans_l_ensemble( e, 64 )
+			&& ! est_dans_l_ensemble( e, 65 )
+			&& ! est_dans_l_ensemble( e, -1 )
+			&& ! est_dans_l_ensemble( e, 100000 )
+			&& comparer_ensemble( e, a ) == 0
+			&& comparer_ensemble( a, e ) == 0
+			, result
+		);
+
+		Ensemble_iterateur it = premier_iterateur_ensemble( e );
+		TEST( get_element( it ) == 0, result );
+		it = iterateur_suivant_ensemble( it );
+		TEST( get_element( it ) == 3, result );
+		it = iterateur_suivant_ensemble( it );
+		TEST( get_element( it ) == 64, result );
+		it = iterateur_suivant_ensemble( it );
+		TEST( get_element( it ) == 200, result );
+		it = iterateur_precedent_ensemble( it );
+		TEST( get_element( it ) == 64, result );
+		it = iterateur_suivant_ensemble( iterateur_suivant_ensemble( it ) );
+		TEST( iterateur_ensemble_est_vide( it ), result );
+		it = trouver_ensemble( e, 3 );
+		TEST( get_element( iterateur_precedent_ensemble( it ) ) == 0, result );
+		TEST( iterateur_ensemble_est_vide( trouver_ensemble( e, 4 ) ), result );
+
+		retirer_element( e, 64 );
+		retirer_element( e, 1000 );
+		TEST( taille_ensemble( e ) == 3 && ! est_dans_l_ensemble( e, 64 ), result );
+
+		liberer_ensemble( e );
+		liberer_ensemble( a );
+	}
+
+	{
+		Ensemble * e1 = bitset( 4, 1, 2, 70, 130 );
+		Ensemble * e2 = bitset( 3, 2, 3, 70 );
+		Ensemble * a1 = avl( 4, 1, 2, 70, 130 );
+		Ensemble * a2 = avl( 3, 2, 3, 70 );
+
+		Ensemble * u = creer_union_ensemble( e1, e2 );
+		Ensemble * d = creer_difference_ensemble( e1, e2 );
+		Ensemble * i = creer_intersection_ensemble( e2, e1 );
+		Ensemble * au = creer_union_ensemble( a1, a2 );
+		Ensemble * ad = creer_difference_ensemble( a1, a2 );
+		Ensemble * ai = creer_intersection_ensemble( a2, a1 );
+
+		TEST(
+			1
+			&& u->representation == ENSEMBLE_BITSET
+			&& comparer_ensemble( u, au ) == 0
+			&& comparer_ensemble( d, ad ) == 0
+			&& comparer_ensemble( i, ai ) == 0
+			&& taille_ensemble( i ) == 2
+			, result
+		);
+
+		liberer_ensemble( u ); liberer_ensemble( d ); liberer_ensemble( i );
+		liberer_ensemble( au ); liberer_ensemble( ad ); liberer_ensemble( ai );
+		liberer_ensemble( e1 ); liberer_ensemble( e2 );
+		liberer_ensemble( a1 ); liberer_ensemble( a2 );
+	}
+
+	{
+		// L'ordre lexicographique doit être le même que pour les AVL.
+		int ens[][3] = {
+			{ 1, 5, -1 }, { 2, -1, -1 }, { 1, -1, -1 }, { 1, 5, 300 },
+			{ 300, -1, -1 }, { -1, -1, -1 }, { 1, 2, 5 }, { 65, 70, -1 }
+		};
+		int n = sizeof(ens) / sizeof(ens[0]);
+		int x, y, k;
+		for( x=0; x<n; x++ ){
+			for( y=0; y<n; y++ ){
+				Ensemble * b1 = creer_ensemble_bitset();
+				Ensemble * b2 = creer_ensemble_bitset();
+				Ensemble * t1 = creer_ensemble( NULL, NULL, NULL );
+				Ensemble * t2 = creer_ensemble( NULL, NULL, NULL );
+				for( k=0; k<3; k++ ){
+					if( ens[x][k] >= 0 ){
+						ajouter_element( b1, ens[x][k] );
+						ajouter_element( t1, ens[x][k] );
+					}
+					if( ens[y][k] >= 0 ){
+						ajouter_element( b2, ens[y][k] );
+						ajouter_element( t2, ens[y][k] );
+					}
+				}
+				TEST(
+					signe( comparer_ensemble( b1, b2 ) ) 
+					== signe( comparer_ensemble( t1, t2 ) ),
+					result
+				);
+				liberer_ensemble( b1 ); liberer_ensemble( b2 );
+				liberer_ensemble( t1 ); liberer_ensemble( t2 );
+			}
+		}
+	}
+
+	{
+		// La taille et l'empreinte ne dépendent pas de la représentation,
+		// ni de l'ordre des opérations.
+		Ensemble * b = bitset( 4, 7, 130, 2, 64 );
+		Ensemble * a = avl( 5, 64, 2, 9, 130, 7 );
+		Ensemble * t = creer_ensemble_tableau( NULL, NULL, NULL );
+		ajouter_elements( t, a );
+		retirer_element( a, 9 );
+		retirer_element( a, 9 );
+		ajouter_element( b, 7 );
+
+		TEST(
+			1
+			&& taille_ensemble( b ) == 4
+			&& taille_ensemble( a ) == 4
+			&& taille_ensemble( t ) == 5
+			&& empreinte_ensemble( a ) == empreinte_ensemble( b )
+			&& empreinte_ensemble( t ) != empreinte_ensemble( b )
+			&& ensembles_egaux( a, b )
+			&& ! ensembles_egaux( t, b )
+			&& comparer_ensemble_par_empreinte( a, b ) == 0
+			&& comparer_ensemble_par_empreinte( b, t ) < 0
+			, result
+		);
+
+		Ensemble * u = creer_union_ensemble( b, t );
+		Ensemble * i = creer_intersection_ensemble( u, b );
+		retirer_elements( u, b );
+		TEST(
+			1
+			&& taille_ensemble( u ) == 1
+			&& empreinte_ensemble( i ) == empreinte_ensemble( a )
+			&& ensembles_egaux( i, a )
+			, result
+		);
+		vider_ensemble( b );
+		TEST( taille_ensemble( b ) == 0 && empreinte_ensemble( b ) == 0, result );
+
+		liberer_ensemble( u ); liberer_ensemble( i );
+		liberer_ensemble( a ); liberer_ensemble( b ); liberer_ensemble( t );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_ensemble_bitset() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdarg.h>
+
+Ensemble * tableau( int n, ... ){
+	va_list pile;
+	int i;
+	Ensemble * e = creer_ensemble_tableau( NULL, NULL, NULL );
+	va_start(pile,n);
+	for (i=0;i<n;i++){
+		ajouter_element( e, va_arg(pile,int) ); 
+ 	}
+	va_end(pile);
+	return e;
+}
+
+Ensemble * avl( int n, ... ){
+	va_list pile;
+	int i;
+	Ensemble * e = creer_ensemble( NULL, NULL, NULL );
+	va_start(pile,n);
+	for (i=0;i<n;i++){
+		ajouter_element( e, va_arg(pile,int) ); 
+ 	}
+	va_end(pile);
+	return e;
+}
+
+int comparer_entier( const int* a, const int* b ){
+	return *a - *b;
+}
+
+int* copier_entier( const int* a ){
+	int* res = xmalloc( sizeof(int) );
+	*res = *a;
+	return res;
+}
+
+void supprimer_entier( int* a ){
+	xfree( a );
+}
+
+int test_ensemble_tableau(){
+	int result = 1;
+
+	{
+		Ensemble * e = tableau( 6, 8, -3, 5, 8, 0, 12 );
+		Ensemble * a = avl( 5, 12, 0, 5, -3, 8 );
+
+		TEST(
+			1
+			&& taille_ensemble( e ) == 5
+			&& est_dans_l_ensemble( e, -3 )
+			&& est_dans_l_ensemble( e, 12 )
+			&& ! est_dans_l_ensemble( e, 7 )
+			&& comparer_ensemble( e, a ) == 0
+			&& comparer_ensemble( a, e ) == 0
+			, result
+		);
+
+		Ensemble_iterateur it = premier_iterateur_ensemble( e );
+		TEST( get_element( it ) == -3, result );
+		it = trouver_ensemble( e, 8 );
+		TEST( get_element( iterateur_precedent_ensemble( it ) ) == 5, result );
+		it = iterateur_suivant_ensemble( iterateur_suivant_ensemble( it ) );
+		TEST( iterateur_ensemble_est_vide( it ), result );
+
+		retirer_element( e, 5 );
+		retirer_element( e, 6 );
+		TEST( taille_ensemble( e ) == 4 && ! est_dans_l_ensemble( e, 5 ), result );
+
+		liberer_ensemble( e );
+		liberer_ensemble( a );
+	}
+
+	{
+		Ensemble * e1 = tableau( 5, 1, 2, 7, 9, 11 );
+		Ensemble * e2 = tableau( 4, 0, 2, 9, 20 );
+		Ensemble * a1 = avl( 5, 1, 2, 7, 9, 11 );
+		Ensemble * a2 = avl( 4, 0, 2, 9, 20 );
+
+		Ensemble * u = creer_union_ensemble( e1, e2 );
+		Ensemble * d = creer_difference_ensemble( e1, e2 );
+		Ensemble * i = creer_intersection_ensemble( e1, e2 );
+		Ensemble * au = creer_union_ensemble( a1, a2 );
+		Ensemble * ad = creer_difference_ensemble( a1, a2 );
+		Ensemble * ai = creer_intersection_ensemble( a1, a2 );
+
+		TEST(
+			1
+			&& u->representation == ENSEMBLE_TABLEAU
+			&& comparer_ensemble( u, au ) == 0
+			&& comparer_ensemble( d, ad ) == 0
+			&& comparer_ensemble( i, ai ) == 0
+			&& taille_ensemble( u ) == 7
+			&& taille_ensemble( i ) == 2
+			, result
+		);
+
+		// Fusion d'un ensemble d'une autre représentation.
+		ajouter_elements( e1, a2 );
+		TEST( comparer_ensemble( e1, au ) == 0, result );
+
+		liberer_ensemble( u ); liberer_ensemble( d ); liberer_ensemble( i );
+		liberer_ensemble( au ); liberer_ensemble( ad ); liberer_ensemble( ai );
+		liberer_ensemble( e1 ); liberer_ensemble( e2 );
+		liberer_ensemble( a1 ); liberer_ensemble( a2 );
+	}
+
+	{
+		// Ensemble de structures dont la mémoire est gérée par l'ensemble.
+		Ensemble * e = creer_ensemble_tableau(
+			( int(*)(const intptr_t, const intptr_t) ) comparer_entier,
+			( intptr_t (*)( const intptr_t ) ) copier_entier,
+			( void(*)(intptr_t) ) supprimer_entier
+		);
+		int valeurs[] = { 4, 1, 9, 4 };
+		int k;
+		for( k=0; k<4; k++ ){
+			ajouter_element( e, (intptr_t) &valeurs[k] );
+		}
+		Ensemble * c = copier_ensemble( e );
+		int x = 9;
+		retirer_element( c, (intptr_t) &x );
+
+		TEST(
+			1
+			&& taille_ensemble( e ) == 3
+			&& taille_ensemble( c ) == 2
+			&& est_dans_l_ensemble( e, (intptr_t) &x )
+			&& ! est_dans_l_ensemble( c, (intptr_t) &x )
+			&& *(int*) get_element( premier_iterateur_ensemble( e ) ) == 1
+			, result
+		);
+
+		Ensemble * u = creer_union_ensemble( c, e );
+		TEST( comparer_ensemble( u, e ) == 0, result );
+
+		liberer_ensemble( u );
+		liberer_ensemble( c );
+		liberer_ensemble( e );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_ensemble_tableau() ){ return 1; }
+
+	return 0;
+}
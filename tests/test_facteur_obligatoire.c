@@ -0,0 +1,65 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Giuliana Bianchi, Adrien Boussicault, Thomas Place, Marc Zeitoun
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <automate.h>
+#include <rationnel.h>
+#include <outils.h>
+
+#include <string.h>
+
+int facteur_vaut( const char * expression, const char * attendu ){
+	size_t taille;
+	char * facteur = facteur_obligatoire( 
+		expression_to_rationnel( expression ), &taille 
+	);
+	int res = taille == strlen( attendu ) && strcmp( facteur, attendu ) == 0;
+	if( ! res ) printf( "%s : '%s' au lieu de '%s'\n", expression, facteur, attendu );
+	xfree( facteur );
+	return res;
+}
+
+int test_facteur_obligatoire(){
+	int result = 1;
+
+	TEST( facteur_vaut( "a", "a" ), result );
+	TEST( facteur_vaut( "a.b.c", "abc" ), result );
+	TEST( facteur_vaut( "a*", "" ), result );
+	TEST( facteur_vaut( "a*.x.y.z.b*", "xyz" ), result );
+	TEST( facteur_vaut( "(a.b)*.x.y.z.(a+b)*.c.d", "xyz" ), result );
+	TEST( facteur_vaut( "a*.b.c.d.e*.f", "bcd" ), result );
+
+	// Jonction du suffixe commun de gauche et du préfixe commun de droite
+	TEST( facteur_vaut( "(a.x.y+b.x.y).(z.w.c+z.w.d)", "xyzw" ), result );
+
+	// Union : plus long facteur commun
+	TEST( facteur_vaut( "a.b.c.d+x.b.c.y", "bc" ), result );
+	TEST( facteur_vaut( "a.b+c.d", "" ), result );
+	TEST( facteur_vaut( "a.b.c+a.b.c", "abc" ), result );
+	TEST( facteur_vaut( "(a.b.c+a.b.c).d", "abcd" ), result );
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_facteur_obligatoire() ){ return 1; }
+
+	return 0;
+}
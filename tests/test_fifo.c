@@ -0,0 +1,103 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2014 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fifo.h"
+#include "outils.h"
+
+int test_fifo(){
+	int result = 1;
+
+	{
+		Fifo * f = creer_fifo();
+		TEST( est_vide( f ), result );
+		int i;
+		for( i=0; i<100; i++ ){
+			ajouter_fifo( f, i );
+		}
+		TEST( taille_fifo( f ) == 100, result );
+		TEST( obtenir_fifo( f ) == 0, result );
+		TEST( obtenir_fin_fifo( f ) == 99, result );
+
+		// Les éléments sortent dans l'ordre où ils sont entrés, même quand le 
+		// tableau circulaire fait le tour.
+		int ordre = 1;
+		for( i=0; i<1000; i++ ){
+			if( retirer_fifo( f ) != i ) ordre = 0;
+			ajouter_fifo( f, i+100 );
+		}
+		TEST( ordre, result );
+		TEST( taille_fifo( f ) == 100, result );
+		while( ! est_vide( f ) ) retirer_fifo( f );
+		TEST( taille_fifo( f ) == 0, result );
+		liberer_fifo( f );
+	}
+
+	{
+		Fifo * f = creer_fifo();
+		ajouter_fifo( f, 2 );
+		ajouter_debut_fifo( f, 1 );
+		ajouter_fifo( f, 3 );
+		ajouter_debut_fifo( f, 0 );
+		TEST( taille_fifo( f ) == 4, result );
+		TEST( obtenir_fifo( f ) == 0, result );
+		TEST( obtenir_fin_fifo( f ) == 3, result );
+		// TEST() évalue deux fois son argument.
+		intptr_t a = retirer_fin_fifo( f );
+		intptr_t b = retirer_fifo( f );
+		intptr_t c = retirer_fin_fifo( f );
+		intptr_t d = retirer_fifo( f );
+		TEST( a == 3 && b == 0 && c == 2 && d == 1, result );
+		TEST( est_vide( f ), result );
+
+		// Agrandissement à partir du début.
+		int i;
+		for( i=0; i<100; i++ ){
+			ajouter_debut_fifo( f, i );
+		}
+		int ordre = 1;
+		for( i=0; i<100; i++ ){
+			if( retirer_fin_fifo( f ) != i ) ordre = 0;
+		}
+		TEST( ordre, result );
+		TEST( est_vide( f ), result );
+		liberer_fifo( f );
+	}
+
+	{
+		// Une longue file ne doit pas épuiser la pile d'appels à sa 
+		// destruction.
+		Fifo * f = creer_fifo();
+		int i;
+		for( i=0; i<1000000; i++ ){
+			ajouter_fifo( f, i );
+		}
+		TEST( taille_fifo( f ) == 1000000, result );
+		liberer_fifo( f );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_fifo() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "automate_equivalence.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdlib.h>
+
+/*
+ * Teste l'inclusion du langage de la première expression dans celui de la 
+ * seconde. Renvoie -1 si le contre-exemple est reconnu par le second 
+ * automate ou pas par le premier.
+ */
+int inclus( const char * expression1, const char * expression2 ){
+	Automate * a1 = Glushkov( expression_to_rationnel( expression1 ) );
+	Automate * a2 = Glushkov( expression_to_rationnel( expression2 ) );
+	uint8_t * mot = NULL;
+	int res = langage_inclus( a1, a2, &mot, NULL );
+	if( 
+		! res && ( 
+			! le_mot_est_reconnu( a1, (const char *) mot ) 
+			|| le_mot_est_reconnu( a2, (const char *) mot ) 
+		)
+	) res = -1;
+	xfree( mot );
+	liberer_automate( a1 );
+	liberer_automate( a2 );
+	return res;
+}
+
+/*
+ * Renvoie -1 si le contre-exemple est reconnu, ou écrit avec une lettre 
+ * hors de l'alphabet.
+ */
+int universel( const Automate * automate ){
+	uint8_t * mot = NULL;
+	size_t taille = 0;
+	int res = automate_universel( automate, &mot, &taille );
+	if( ! res ){
+		if( le_mot_est_reconnu( automate, (const char *) mot ) ) res = -1;
+		size_t i;
+		for( i=0; i<taille; i++ ){
+			if( ! est_dans_l_ensemble( get_alphabet( automate ), mot[i] ) ){
+				res = -1;
+			}
+		}
+	}
+	xfree( mot );
+	return res;
+}
+
+int universel_expression( const char * expression ){
+	Automate * automate = Glushkov( expression_to_rationnel( expression ) );
+	int res = universel( automate );
+	liberer_automate( automate );
+	return res;
+}
+
+int test_langage_inclus(){
+	int result = 1;
+
+	TEST( inclus( "a.b", "(a+b)*" ) == 1, result );
+	TEST( inclus( "(a+b)*", "a.b" ) == 0, result );
+	TEST( inclus( "(a.b)*.a", "a.(b.a)*" ) == 1, result );
+	TEST( inclus( "(a+b)*.a.(a+b).(a+b)", "(a+b)*.a.(a+b).(a+b)+b*" ) == 1, result );
+	TEST( inclus( "(a+b)*.a.(a+b).(a+b)", "(a+b)*.b.(a+b).(a+b)" ) == 0, result );
+	TEST( inclus( "a*", "a.a*" ) == 0, result );
+	TEST( inclus( "c", "a+b" ) == 0, result );
+
+	TEST( universel_expression( "(a+b)*" ) == 1, result );
+	TEST( universel_expression( "(a*.b*)*" ) == 1, result );
+	TEST( universel_expression( "(a+b)*.a.(a+b).(a+b)+(a+b)*.b.(a+b).(a+b)+a+b+a.a+a.b+b.a+b.b" ) == 0, result );
+	TEST( universel_expression( "a.a*" ) == 0, result );
+	TEST( universel_expression( "(a+b)*.a+(a+b)*.b" ) == 0, result );
+
+	{
+		// Sans le mot vide, l'automate suivant est universel.
+		Automate * automate = Glushkov( expression_to_rationnel( 
+			"(a+b)*.a.(a+b).(a+b)+(a+b)*.b.(a+b).(a+b)+a+b+a.a+a.b+b.a+b.b"
+		) );
+		size_t taille = 1;
+		uint8_t * mot = NULL;
+		int res = automate_universel( automate, &mot, &taille );
+		TEST( ! res, result );
+		TEST( mot && taille == 0, result );
+		xfree( mot );
+		liberer_automate( automate );
+	}
+
+	{
+		// Comparaison avec automates_equivalents() sur des automates aléatoires :
+		// L1 est inclus dans L2 si et seulement si L1 = L1 ∩ L2.
+		srand( 24 );
+		int essai;
+		for( essai = 0; essai < 300; essai++ ){
+			Automate * automates[2];
+			int i;
+			for( i=0; i<2; i++ ){
+				automates[i] = creer_automate();
+				int n = 1 + rand() % 6;
+				int t;
+				for( t=0; t < 3 * n; t++ ){
+					ajouter_transition( 
+						automates[i], rand() % n, 'a' + rand() % 2, rand() % n 
+					);
+				}
+				ajouter_etat_initial( automates[i], 0 );
+				ajouter_etat_final( automates[i], rand() % n );
+				ajouter_etat_final( automates[i], rand() % n );
+			}
+			Automate * intersection = creer_intersection_des_automates( 
+				automates[0], automates[1] 
+			);
+			int attendu = automates_equivalents( 
+				intersection, automates[0], NULL, NULL 
+			);
+			uint8_t * mot = NULL;
+			int res = langage_inclus( automates[0], automates[1], &mot, NULL );
+			int coherent = ( res == attendu ) && ( res || (
+				le_mot_est_reconnu( automates[0], (const char *) mot ) &&
+				! le_mot_est_reconnu( automates[1], (const char *) mot )
+			) );
+			TEST( coherent, result );
+			xfree( mot );
+
+			Automate * tout = creer_automate();
+			ajouter_etat_initial( tout, 0 );
+			ajouter_etat_final( tout, 0 );
+			ajouter_transition( tout, 0, 'a', 0 );
+			ajouter_transition( tout, 0, 'b', 0 );
+			if( taille_ensemble( get_alphabet( automates[0] ) ) == 2 ){
+				attendu = automates_equivalents( automates[0], tout, NULL, NULL );
+				TEST( universel( automates[0] ) == attendu, result );
+			}
+			liberer_automate( tout );
+			liberer_automate( intersection );
+			liberer_automate( automates[0] );
+			liberer_automate( automates[1] );
+		}
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_langage_inclus() ){ return 1; }
+
+	return 0;
+}
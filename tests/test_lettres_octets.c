@@ -0,0 +1,111 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "automate_fige.h"
+#include "automate_dense.h"
+#include "automate_bits.h"
+#include "automate_paresseux.h"
+#include "outils.h"
+
+/*
+ * Automate de (\0 \x80* \xff)* sur les octets.
+ */
+Automate * creer_automate_test(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, '\0', 1 );
+	ajouter_transition( automate, 1, '\x80', 2 );
+	ajouter_transition( automate, 2, '\x80', 2 );
+	ajouter_transition( automate, 1, '\xff', 3 );
+	ajouter_transition( automate, 2, '\xff', 3 );
+	ajouter_transition( automate, 3, '\0', 1 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 3 );
+	return automate;
+}
+
+int test_lettres_octets(){
+	int result = 1;
+
+	Automate * automate = creer_automate_test();
+
+	// Les lettres sont rangées comme des entiers de 0 à 255.
+	TEST( taille_ensemble( get_alphabet( automate ) ) == 3, result );
+	TEST( est_dans_l_ensemble( get_alphabet( automate ), 0xff ), result );
+	TEST( est_dans_l_ensemble( get_alphabet( automate ), 0x80 ), result );
+	TEST( est_une_lettre_de_l_automate( automate, '\xff' ), result );
+	TEST( est_une_lettre_de_l_automate( automate, 0xff ), result );
+	TEST( ! est_une_lettre_de_l_automate( automate, 'a' ), result );
+	TEST( est_une_transition_de_l_automate( automate, 1, 0x80, 2 ), result );
+
+	const uint8_t mot[] = { 0x00, 0x80, 0x80, 0xff, 0x00, 0xff };
+	TEST( le_mot_est_reconnu_octets( automate, mot, 0 ), result );
+	TEST( ! le_mot_est_reconnu_octets( automate, mot, 1 ), result );
+	TEST( ! le_mot_est_reconnu_octets( automate, mot, 3 ), result );
+	TEST( le_mot_est_reconnu_octets( automate, mot, 4 ), result );
+	TEST( ! le_mot_est_reconnu_octets( automate, mot, 5 ), result );
+	TEST( le_mot_est_reconnu_octets( automate, mot, 6 ), result );
+	TEST( le_mot_est_reconnu_octets( automate, mot + 4, 2 ), result );
+	TEST( le_mot_est_reconnu( automate, "" ), result );
+
+	Ensemble * e = delta_star_octets( automate, get_initiaux( automate ), mot, 3 );
+	TEST( taille_ensemble( e ) == 1 && est_dans_l_ensemble( e, 2 ), result );
+	liberer_ensemble( e );
+
+	// Les automates construits à partir de celui-ci gardent ses lettres.
+	Automate * minimal = creer_automate_minimal( automate );
+	TEST( le_mot_est_reconnu_octets( minimal, mot, 6 ), result );
+	TEST( ! le_mot_est_reconnu_octets( minimal, mot, 5 ), result );
+	TEST( est_une_lettre_de_l_automate( minimal, '\x80' ), result );
+
+	Automate_dense * dense = compiler_automate( minimal );
+	Lecture_dense lecture;
+	commencer_lecture_dense( &lecture, dense );
+	lire_morceau_dense( &lecture, (const char*) mot, 6 );
+	TEST( lecture_est_acceptante_dense( &lecture ), result );
+	liberer_automate_dense( dense );
+	liberer_automate( minimal );
+
+	Automate_bits * bits = compiler_automate_bits( automate );
+	Automate_paresseux * paresseux = creer_automate_paresseux( automate, 0 );
+	size_t taille;
+	for( taille=0; taille<=6; taille++ ){
+		int attendu = le_mot_est_reconnu_octets( automate, mot, taille );
+		TEST( le_mot_est_reconnu_bits_octets( bits, mot, taille ) == attendu, result );
+		TEST( 
+			le_mot_est_reconnu_paresseux_octets( paresseux, mot, taille ) 
+				== attendu
+			, result 
+		);
+	}
+	liberer_automate_paresseux( paresseux );
+	liberer_automate_bits( bits );
+
+	liberer_automate( automate );
+	return result;
+}
+
+int main(){
+
+	if( ! test_lettres_octets() ){ return 1; }
+
+	return 0;
+}
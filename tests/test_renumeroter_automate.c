@@ -0,0 +1,149 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "rationnel.h"
+#include "table.h"
+#include "outils.h"
+
+/*
+ * Compare les deux automates sur tous les mots de longueur 'longueur' sur 
+ * {a, b} qui prolongent 'mot'.
+ */
+int comparer_sur_les_mots( 
+	const Automate * automate_1, const Automate * automate_2, 
+	char * mot, int position, int longueur
+){
+	if( position == longueur ){
+		mot[position] = '\0';
+		return le_mot_est_reconnu( automate_1, mot ) 
+			== le_mot_est_reconnu( automate_2, mot );
+	}
+	mot[position] = 'a';
+	if( ! comparer_sur_les_mots( automate_1, automate_2, mot, position+1, longueur ) ){
+		return 0;
+	}
+	mot[position] = 'b';
+	return comparer_sur_les_mots( automate_1, automate_2, mot, position+1, longueur );
+}
+
+int meme_langage_jusqu_a( 
+	const Automate * automate_1, const Automate * automate_2, int longueur_max
+){
+	char mot[16];
+	int longueur;
+	for( longueur=0; longueur<=longueur_max; longueur++ ){
+		if( ! comparer_sur_les_mots( automate_1, automate_2, mot, 0, longueur ) ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_renumeroter_automate(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 1000, 'a', -5 );
+		ajouter_transition( automate, -5, 'b', 1000 );
+		ajouter_transition( automate, -5, 'a', 42 );
+		ajouter_transition( automate, 42, 'b', 42 );
+		ajouter_etat( automate, 7 );
+		ajouter_etat_initial( automate, 1000 );
+		ajouter_etat_final( automate, 42 );
+
+		// Ordre croissant des numéros
+		Table * correspondance;
+		Automate * res = renumeroter_automate( automate, 0, &correspondance );
+		TEST( taille_ensemble( get_etats( res ) ) == 4, result );
+		TEST( get_min_etat( res ) == 0 && get_max_etat( res ) == 3, result );
+		TEST( get_valeur( trouver_table( correspondance, -5 ) ) == 0, result );
+		TEST( get_valeur( trouver_table( correspondance, 7 ) ) == 1, result );
+		TEST( get_valeur( trouver_table( correspondance, 42 ) ) == 2, result );
+		TEST( get_valeur( trouver_table( correspondance, 1000 ) ) == 3, result );
+		TEST( est_un_etat_initial_de_l_automate( res, 3 ), result );
+		TEST( est_un_etat_final_de_l_automate( res, 2 ), result );
+		TEST( est_une_transition_de_l_automate( res, 0, 'a', 2 ), result );
+		TEST( nombre_de_transitions( res ) == 4, result );
+		TEST( meme_langage_jusqu_a( automate, res, 8 ), result );
+		liberer_table( correspondance );
+		liberer_automate( res );
+
+		// Ordre du parcours en largeur ; l'état 7 n'est pas accessible.
+		res = renumeroter_automate( automate, 1, &correspondance );
+		TEST( get_valeur( trouver_table( correspondance, 1000 ) ) == 0, result );
+		TEST( get_valeur( trouver_table( correspondance, -5 ) ) == 1, result );
+		TEST( get_valeur( trouver_table( correspondance, 42 ) ) == 2, result );
+		TEST( get_valeur( trouver_table( correspondance, 7 ) ) == 3, result );
+		TEST( est_un_etat_initial_de_l_automate( res, 0 ), result );
+		TEST( est_une_transition_de_l_automate( res, 1, 'b', 0 ), result );
+		TEST( meme_langage_jusqu_a( automate, res, 8 ), result );
+		liberer_table( correspondance );
+		liberer_automate( res );
+
+		liberer_automate( automate );
+	}
+
+	{
+		// Les états de l'intersection ont des numéros épars.
+		Automate * pair_a = creer_automate();
+		ajouter_transition( pair_a, 0, 'a', 1 );
+		ajouter_transition( pair_a, 1, 'a', 0 );
+		ajouter_transition( pair_a, 0, 'b', 0 );
+		ajouter_transition( pair_a, 1, 'b', 1 );
+		ajouter_etat_initial( pair_a, 0 );
+		ajouter_etat_final( pair_a, 0 );
+		Automate * fin_b = creer_automate();
+		ajouter_transition( fin_b, 5, 'a', 5 );
+		ajouter_transition( fin_b, 5, 'b', 6 );
+		ajouter_transition( fin_b, 6, 'a', 5 );
+		ajouter_transition( fin_b, 6, 'b', 6 );
+		ajouter_etat_initial( fin_b, 5 );
+		ajouter_etat_final( fin_b, 6 );
+		Automate * produit = creer_intersection_des_automates( pair_a, fin_b );
+		TEST( get_max_etat( produit ) > 50, result );
+
+		Automate * res = renumeroter_automate( produit, 1, NULL );
+		TEST( get_max_etat( res ) == 3, result );
+		TEST( meme_langage_jusqu_a( produit, res, 8 ), result );
+
+		// Arden travaille sur les numéros compacts.
+		Rationnel * rat = Arden( produit );
+		numeroter_rationnel( rat );
+		Automate * glushkov = Glushkov( rat );
+		TEST( meme_langage_jusqu_a( produit, glushkov, 8 ), result );
+
+		liberer_automate( glushkov );
+		liberer_automate( res );
+		liberer_automate( produit );
+		liberer_automate( fin_b );
+		liberer_automate( pair_a );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_renumeroter_automate() ){ return 1; }
+
+	return 0;
+}
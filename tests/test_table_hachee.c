@@ -0,0 +1,131 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table.h"
+#include "outils.h"
+
+#include <string.h>
+
+int comparer_chaine( const char* a, const char* b ){
+	return strcmp( a, b );
+}
+
+char* copier_chaine( const char* a ){
+	char* res = xmalloc( strlen(a) + 1 );
+	strcpy( res, a );
+	return res;
+}
+
+void supprimer_chaine( char* a ){
+	xfree( a );
+}
+
+uint64_t hacher_chaine( const char* a ){
+	uint64_t h = 14695981039346656037ULL;
+	while( *a ){
+		h = ( h ^ (unsigned char) *a++ ) * 1099511628211ULL;
+	}
+	return h;
+}
+
+int test_table_hachee(){
+	int result = 1;
+
+	{
+		Table * t = creer_table_hachee( NULL, NULL, NULL, NULL );
+		int i;
+		for( i=0; i<1000; i++ ){
+			add_table( t, 7*i, i );
+		}
+		TEST( taille_table( t ) == 1000, result );
+		TEST( get_valeur( trouver_table( t, 7*500 ) ) == 500, result );
+		TEST( iterateur_est_vide( trouver_table( t, 3 ) ), result );
+
+		// Les clés sont parcourues dans l'ordre d'insertion.
+		Table_iterateur it = premier_iterateur_table( t );
+		TEST( get_cle( it ) == 0, result );
+		it = iterateur_suivant_table( it );
+		TEST( get_cle( it ) == 7, result );
+
+		for( i=0; i<1000; i+=2 ){
+			TEST( delete_table( t, 7*i ) == i, result );
+		}
+		TEST( taille_table( t ) == 500, result );
+		TEST( iterateur_est_vide( trouver_table( t, 0 ) ), result );
+		TEST( get_valeur( trouver_table( t, 7*501 ) ) == 501, result );
+		TEST( get_cle( premier_iterateur_table( t ) ) == 7, result );
+
+		// Les cases supprimées sont réutilisées par le rehachage.
+		for( i=0; i<1000; i+=2 ){
+			add_table( t, 7*i, -i );
+		}
+		TEST( taille_table( t ) == 1000, result );
+		TEST( get_valeur( trouver_table( t, 7*998 ) ) == -998, result );
+
+		add_table( t, 7, 42 );
+		TEST( taille_table( t ) == 1000, result );
+		TEST( get_valeur( trouver_table( t, 7 ) ) == 42, result );
+
+		int nb = 0;
+		for(
+			it = premier_iterateur_table( t );
+			! iterateur_est_vide( it );
+			it = iterateur_suivant_table( it )
+		){
+			nb++;
+		}
+		TEST( nb == 1000, result );
+
+		vider_table( t );
+		TEST( taille_table( t ) == 0, result );
+		TEST( iterateur_est_vide( premier_iterateur_table( t ) ), result );
+
+		liberer_table( t );
+	}
+
+	{
+		Table * t = creer_table_hachee(
+			( uint64_t(*)(const intptr_t) ) hacher_chaine,
+			( int(*)(const intptr_t, const intptr_t) ) comparer_chaine,
+			( intptr_t(*)(const intptr_t) ) copier_chaine,
+			( void(*)(intptr_t) ) supprimer_chaine
+		);
+		char cle[8];
+		strcpy( cle, "abc" );
+		add_table( t, (intptr_t) "abc", 1 );
+		add_table( t, (intptr_t) "abd", 2 );
+		add_table( t, (intptr_t) cle, 3 );
+		TEST( taille_table( t ) == 2, result );
+		TEST( get_valeur( trouver_table( t, (intptr_t) "abc" ) ) == 3, result );
+		TEST( (char*) get_cle( trouver_table( t, (intptr_t) "abc" ) ) != cle, result );
+		TEST( delete_table( t, (intptr_t) "abd" ) == 2, result );
+		TEST( taille_table( t ) == 1, result );
+		liberer_table( t );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_table_hachee() ){ return 1; }
+
+	return 0;
+}